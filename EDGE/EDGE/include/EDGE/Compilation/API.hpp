@@ -34,3 +34,13 @@
 		#pragma message "Warning: Your compiler does not support exporting / importing symbols from shared library."
 	#endif
 #endif
+
+// Profiler toggle (see Core/Profiler.hpp). When EDGE_PROFILE is 0 every
+// EDGE_PROFILE_SCOPE compiles away entirely; debug builds default to on.
+#ifndef EDGE_PROFILE
+	#ifdef EDGE_DEBUG
+		#define EDGE_PROFILE 1
+	#else
+		#define EDGE_PROFILE 0
+	#endif
+#endif
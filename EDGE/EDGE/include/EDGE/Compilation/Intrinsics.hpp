@@ -0,0 +1,14 @@
+#pragma once
+
+// Detects availability of x86 SIMD intrinsics.
+// Every configuration we ship (MSVC Win32/x64) guarantees at least SSE2,
+// but keep a scalar fallback for exotic targets.
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+	#define EDGE_SIMD_SSE 1
+	#include <intrin.h>
+#elif defined(__SSE2__)
+	#define EDGE_SIMD_SSE 1
+	#include <immintrin.h>
+#else
+	#define EDGE_SIMD_SSE 0
+#endif
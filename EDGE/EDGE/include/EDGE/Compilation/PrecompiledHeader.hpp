@@ -15,6 +15,7 @@
 #include <filesystem>
 #include <string>
 #include <string_view>
+#include <charconv>
 #include <algorithm>
 #include <functional>
 #include <iterator>
@@ -50,6 +51,12 @@
 #include <cwctype>
 #include <codecvt>
 
+// Multithreading
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
 // Exceptions:
 #include <exception>
 #include <stdexcept>
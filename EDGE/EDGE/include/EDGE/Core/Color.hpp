@@ -7,6 +7,7 @@
 
 #include <EDGE/Core/Color/ColorHelper.hpp>
 #include <EDGE/Core/Color/ColorSchemeRGBA.hpp>
+#include <EDGE/Core/Color/ColorPacked32.hpp>
 
 namespace edge
 {	
@@ -773,3 +774,7 @@ namespace colors
 	constexpr Color<> Zinnwalditebrown{ 0x2c1608ff };
 }
 }
+
+// Name-based lookup over the constants above (colors::find).
+#include <EDGE/Core/Color/NamedColors.hpp>
+
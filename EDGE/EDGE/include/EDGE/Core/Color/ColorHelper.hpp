@@ -2,6 +2,10 @@
 
 #include EDGE_PCH
 
+// Custom includes:
+#include <EDGE/Compilation/Intrinsics.hpp>
+#include <EDGE/Core/Span.hpp>
+
 namespace edge::color
 {
 
@@ -19,33 +23,24 @@ void convertHSVtoRGB(_floatType const hue_, _floatType const sat_, _floatType co
 {
 	using type = _floatType;
 
-	assert(hue_ >= 0 && hue < 360);
+	assert(hue_ >= 0 && hue_ < 360);
 
-	type chroma	= value_ * sat_;
-	type x		= chroma * (type{ 1 } - std::abs(std::fmod(hue_ / type{ 60 }, type{ 2 }) - type{ 1 }));
-	type m		= value_ - chroma;
+	// Branchless sextant formulation: channel(n) = v * (1 - s * clamp(min(k, 4 - k), 0, 1))
+	// with k = fmod(n + h/60, 6). Equivalent to the classic six-way if/else chain over the
+	// sextant, but free of the mispredicts that chain suffers on hue-gradient inputs, and
+	// the exact form the batch overload below vectorizes.
+	type const scaledHue = hue_ / type{ 60 };
+	auto const channel = [&](type const n_)
+		{
+			type k = n_ + scaledHue;
+			k -= type{ 6 } * static_cast<type>(k >= type{ 6 });
+			type const t = std::max(type{ 0 }, std::min({ k, type{ 4 } - k, type{ 1 } }));
+			return value_ * (type{ 1 } - sat_ * t);
+		};
 
-	if (hue_ >= type{ 0 } && hue_ < type{ 60 }) {
-		red_ = chroma; green_ = x; blue_ = 0;
-	}
-	else if (hue_ >= type{ 60 } && hue_ < type{ 120 }) {
-		red_ = x; green_ = chroma; blue_ = 0;
-	}
-	else if (hue_ >= type{ 120 } && hue_ < type{ 180 }) {
-		red_ = 0; green_ = chroma; blue_ = x;
-	}
-	else if (hue_ >= type{ 180 } && hue_ < type{ 240 }) {
-		red_ = 0; green_ = x; blue_ = chroma;
-	}
-	else if (hue_ >= type{ 240 } && hue_ < type{ 300 }) {
-		red_ = x; green_ = 0; blue_ = chroma;
-	}
-	else if (hue_ >= type{ 300 } && hue_ < type{ 360 }) {
-		red_ = chroma; green_ = 0; blue_ = x;
-	}
-	else { red_ = 0; green_ = 0;blue_ = 0; }
-
-	red_ += m; green_ += m; blue_ += m;
+	red_	= channel(type{ 5 });
+	green_	= channel(type{ 3 });
+	blue_	= channel(type{ 1 });
 }
 
 /// <summary>
@@ -88,4 +83,134 @@ void convertRGBtoHSV(_floatType const red_, _floatType const green_, _floatType
 	value_ = chromaMax;
 }
 
+/// <summary>
+/// Converts whole arrays of HSV[ - : <360 : 1 ] colors to RGB[ - : 1 ] - the batch form of
+/// <see cref="convertHSVtoRGB"/>. Float spans are processed four colors per iteration using SSE.
+/// </summary>
+/// <param name="hue_">The HSV hue components (range: 0 to &lt;360).</param>
+/// <param name="sat_">The HSV saturation components (range: 0 to 1).</param>
+/// <param name="value_">The HSV value components (range: 0 to 1).</param>
+/// <param name="red_">[out] The red components (range: 0 to 1).</param>
+/// <param name="green_">[out] The green components (range: 0 to 1).</param>
+/// <param name="blue_">[out] The blue components (range: 0 to 1).</param>
+template <typename _floatType>
+inline void convertHSVtoRGB(Span<_floatType const> hue_, Span<_floatType const> sat_, Span<_floatType const> value_,
+	Span<_floatType> red_, Span<_floatType> green_, Span<_floatType> blue_)
+{
+	// # Assertion note:
+	// Every span passed to a batch converter must have the same size. Fix your code.
+	assert(	hue_.size() == sat_.size() && hue_.size() == value_.size()
+		&&	hue_.size() == red_.size() && hue_.size() == green_.size() && hue_.size() == blue_.size());
+
+	std::size_t const count = hue_.size();
+	std::size_t i = 0;
+#if EDGE_SIMD_SSE
+	if constexpr (std::is_same_v<_floatType, float>)
+	{
+		__m128 const zero	= _mm_setzero_ps();
+		__m128 const one	= _mm_set1_ps(1.f);
+		__m128 const four	= _mm_set1_ps(4.f);
+		__m128 const six	= _mm_set1_ps(6.f);
+		__m128 const inv60	= _mm_set1_ps(1.f / 60.f);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 const h = _mm_mul_ps(_mm_loadu_ps(hue_.data() + i), inv60);
+			__m128 const s = _mm_loadu_ps(sat_.data() + i);
+			__m128 const v = _mm_loadu_ps(value_.data() + i);
+
+			// Vector form of the scalar branchless sextant: k = fmod(n + h/60, 6)
+			// becomes a compare-and-subtract since n + h/60 < 12 by construction.
+			auto const channel = [&](__m128 const n_)
+				{
+					__m128 k = _mm_add_ps(n_, h);
+					k = _mm_sub_ps(k, _mm_and_ps(six, _mm_cmpge_ps(k, six)));
+					__m128 const t = _mm_max_ps(zero, _mm_min_ps(_mm_min_ps(k, _mm_sub_ps(four, k)), one));
+					return _mm_mul_ps(v, _mm_sub_ps(one, _mm_mul_ps(s, t)));
+				};
+
+			_mm_storeu_ps(red_.data() + i,		channel(_mm_set1_ps(5.f)));
+			_mm_storeu_ps(green_.data() + i,	channel(_mm_set1_ps(3.f)));
+			_mm_storeu_ps(blue_.data() + i,		channel(_mm_set1_ps(1.f)));
+		}
+	}
+#endif
+	for (; i < count; ++i)
+		convertHSVtoRGB(hue_[i], sat_[i], value_[i], red_[i], green_[i], blue_[i]);
+}
+
+/// <summary>
+/// Converts whole arrays of RGB[ - : 255 ] colors to HSV[ - : <360 : 1 ] - the batch form of
+/// <see cref="convertRGBtoHSV"/>. Float spans are processed four colors per iteration using SSE.
+/// </summary>
+/// <param name="red_">The red components (range: 0 to 255).</param>
+/// <param name="green_">The green components (range: 0 to 255).</param>
+/// <param name="blue_">The blue components (range: 0 to 255).</param>
+/// <param name="hue_">[out] The HSV hue components (range: 0 to &lt;360).</param>
+/// <param name="sat_">[out] The HSV saturation components (range: 0 to 1).</param>
+/// <param name="value_">[out] The HSV value components (range: 0 to 1).</param>
+template <typename _floatType>
+inline void convertRGBtoHSV(Span<_floatType const> red_, Span<_floatType const> green_, Span<_floatType const> blue_,
+	Span<_floatType> hue_, Span<_floatType> sat_, Span<_floatType> value_)
+{
+	// # Assertion note:
+	// Every span passed to a batch converter must have the same size. Fix your code.
+	assert(	red_.size() == green_.size() && red_.size() == blue_.size()
+		&&	red_.size() == hue_.size() && red_.size() == sat_.size() && red_.size() == value_.size());
+
+	std::size_t const count = red_.size();
+	std::size_t i = 0;
+#if EDGE_SIMD_SSE
+	if constexpr (std::is_same_v<_floatType, float>)
+	{
+		__m128 const zero	= _mm_setzero_ps();
+		__m128 const one	= _mm_set1_ps(1.f);
+		__m128 const two	= _mm_set1_ps(2.f);
+		__m128 const four	= _mm_set1_ps(4.f);
+		__m128 const sixty	= _mm_set1_ps(60.f);
+		__m128 const inv255	= _mm_set1_ps(1.f / 255.f);
+
+		// Select helper: mask ? a : b.
+		auto const select = [](__m128 const mask_, __m128 const a_, __m128 const b_)
+			{
+				return _mm_or_ps(_mm_and_ps(mask_, a_), _mm_andnot_ps(mask_, b_));
+			};
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 const r = _mm_mul_ps(_mm_loadu_ps(red_.data() + i), inv255);
+			__m128 const g = _mm_mul_ps(_mm_loadu_ps(green_.data() + i), inv255);
+			__m128 const b = _mm_mul_ps(_mm_loadu_ps(blue_.data() + i), inv255);
+
+			__m128 const chromaMax	= _mm_max_ps(_mm_max_ps(r, g), b);
+			__m128 const chromaMin	= _mm_min_ps(_mm_min_ps(r, g), b);
+			__m128 const delta		= _mm_sub_ps(chromaMax, chromaMin);
+
+			// Grey (delta == 0) and black (max == 0) lanes divide by a harmless 1
+			// here and get masked to 0 below.
+			__m128 const greyMask	= _mm_cmpeq_ps(delta, zero);
+			__m128 const blackMask	= _mm_cmpeq_ps(chromaMax, zero);
+			__m128 const safeDelta	= select(greyMask, one, delta);
+			__m128 const safeMax	= select(blackMask, one, chromaMax);
+
+			// Same priority as the scalar if/else chain: red first, then green, then blue.
+			__m128 const hueRed		= _mm_div_ps(_mm_sub_ps(g, b), safeDelta);
+			__m128 const hueGreen	= _mm_add_ps(_mm_div_ps(_mm_sub_ps(b, r), safeDelta), two);
+			__m128 const hueBlue	= _mm_add_ps(_mm_div_ps(_mm_sub_ps(r, g), safeDelta), four);
+			__m128 const redMask	= _mm_cmpeq_ps(chromaMax, r);
+			__m128 const greenMask	= _mm_andnot_ps(redMask, _mm_cmpeq_ps(chromaMax, g));
+
+			__m128 hue = select(redMask, hueRed, select(greenMask, hueGreen, hueBlue));
+			hue = _mm_andnot_ps(greyMask, _mm_mul_ps(hue, sixty));
+
+			_mm_storeu_ps(hue_.data() + i,		hue);
+			_mm_storeu_ps(sat_.data() + i,		_mm_andnot_ps(blackMask, _mm_div_ps(delta, safeMax)));
+			_mm_storeu_ps(value_.data() + i,	chromaMax);
+		}
+	}
+#endif
+	for (; i < count; ++i)
+		convertRGBtoHSV(red_[i], green_[i], blue_[i], hue_[i], sat_[i], value_[i]);
+}
+
 } // namespace edge::color
\ No newline at end of file
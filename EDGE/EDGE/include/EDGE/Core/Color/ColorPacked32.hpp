@@ -0,0 +1,351 @@
+// File description:
+// Implements packed 32-bit RGBA color storage and batch blend/lerp/modulate kernels.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Compilation/Intrinsics.hpp>
+#include <EDGE/Core/Span.hpp>
+#include <EDGE/Core/Color/ColorSchemeRGBA.hpp>
+
+namespace edge
+{
+
+/// <summary>
+/// A color packed into a single 32-bit word - byte layout R, G, B, A in memory.
+/// </summary>
+/// <remarks>
+/// <para>
+///		<see cref="ColorSchemeRGBA"/> keeps four separate members and is the right
+///		interface for per-color math; per-tile color arrays blended every frame want
+///		4 bytes per color and whole-register loads instead. The kernels in
+///		<see cref="color::batch"/> stream four packed colors per SSE iteration.
+/// </para>
+/// </remarks>
+struct ColorPacked32
+{
+	using ValueType = std::uint32_t;
+
+	// Little-endian packing of the R, G, B, A memory bytes: (a << 24) | (b << 16) | (g << 8) | r.
+	std::uint32_t value;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="ColorPacked32"/> struct (opaque black).
+	/// </summary>
+	constexpr ColorPacked32()
+		: value{ 0xFF000000u }
+	{
+	}
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="ColorPacked32"/> struct.
+	/// </summary>
+	/// <param name="color_">The color as 0xRRGGBBAA - same convention as the
+	/// <see cref="ColorSchemeRGBA"/> constructor and the <see cref="colors"/> literals.</param>
+	constexpr explicit ColorPacked32(std::uint32_t const color_)
+		: value{
+			(  color_ >> 24)				|	// r
+			(((color_ >> 16) & 0xFF) << 8)	|	// g
+			(((color_ >>  8) & 0xFF) << 16)	|	// b
+			(( color_        & 0xFF) << 24)		// a
+		}
+	{
+	}
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="ColorPacked32"/> struct from the 8-bit scheme.
+	/// </summary>
+	/// <param name="color_">The unpacked color.</param>
+	constexpr ColorPacked32(ColorSchemeRGBA<std::uint8_t, 255> const & color_)
+		: value{
+			static_cast<std::uint32_t>(color_.r)		|
+			static_cast<std::uint32_t>(color_.g) << 8	|
+			static_cast<std::uint32_t>(color_.b) << 16	|
+			static_cast<std::uint32_t>(color_.a) << 24
+		}
+	{
+	}
+
+	/// <summary>
+	/// Creates packed color from channel values.
+	/// </summary>
+	/// <param name="r_">The red channel value.</param>
+	/// <param name="g_">The green channel value.</param>
+	/// <param name="b_">The blue channel value.</param>
+	/// <param name="a_">The alpha channel value.</param>
+	constexpr static ColorPacked32 fromRGBA(std::uint8_t const r_, std::uint8_t const g_, std::uint8_t const b_, std::uint8_t const a_ = 255)
+	{
+		ColorPacked32 color;
+		color.value =	static_cast<std::uint32_t>(r_)			|
+						static_cast<std::uint32_t>(g_) << 8		|
+						static_cast<std::uint32_t>(b_) << 16	|
+						static_cast<std::uint32_t>(a_) << 24;
+		return color;
+	}
+
+	// Channel accessors:
+	constexpr std::uint8_t r() const { return static_cast<std::uint8_t>( value        & 0xFF); }
+	constexpr std::uint8_t g() const { return static_cast<std::uint8_t>((value >>  8) & 0xFF); }
+	constexpr std::uint8_t b() const { return static_cast<std::uint8_t>((value >> 16) & 0xFF); }
+	constexpr std::uint8_t a() const { return static_cast<std::uint8_t>( value >> 24        ); }
+
+	/// <summary>
+	/// Converts this color back to the 8-bit scheme.
+	/// </summary>
+	/// <returns>The unpacked color.</returns>
+	constexpr operator ColorSchemeRGBA<std::uint8_t, 255>() const
+	{
+		return ColorSchemeRGBA<std::uint8_t, 255>{ this->r(), this->g(), this->b(), this->a() };
+	}
+
+	constexpr bool operator==(ColorPacked32 const other_) const {
+		return value == other_.value;
+	}
+	constexpr bool operator!=(ColorPacked32 const other_) const {
+		return value != other_.value;
+	}
+};
+
+static_assert(sizeof(ColorPacked32) == 4, "ColorPacked32 must stay one 32-bit word.");
+
+namespace color::batch
+{
+
+namespace detail
+{
+
+// Exact round(x / 255) for x <= 255 * 255, no division.
+constexpr std::uint32_t div255(std::uint32_t const x_)
+{
+	auto const t = x_ + 128;
+	return (t + (t >> 8)) >> 8;
+}
+
+// Per-byte a * w + b * (255 - w) with exact /255 rounding (w taken per call).
+constexpr std::uint32_t weighPixel(std::uint32_t const a_, std::uint32_t const b_, std::uint32_t const weightA_)
+{
+	std::uint32_t const weightB = 255 - weightA_;
+	std::uint32_t out = 0;
+	for (std::uint32_t shift = 0; shift < 32; shift += 8)
+	{
+		auto const channelA = (a_ >> shift) & 0xFF;
+		auto const channelB = (b_ >> shift) & 0xFF;
+		out |= div255(channelA * weightA_ + channelB * weightB) << shift;
+	}
+	return out;
+}
+
+// Per-byte (a * b) / 255 with exact rounding.
+constexpr std::uint32_t modulatePixel(std::uint32_t const a_, std::uint32_t const b_)
+{
+	std::uint32_t out = 0;
+	for (std::uint32_t shift = 0; shift < 32; shift += 8)
+		out |= div255(((a_ >> shift) & 0xFF) * ((b_ >> shift) & 0xFF)) << shift;
+	return out;
+}
+
+#if EDGE_SIMD_SSE
+
+// Exact round(x / 255) on eight 16-bit lanes (inputs <= 255 * 255).
+inline __m128i div255Epi16(__m128i t_)
+{
+	t_ = _mm_add_epi16(t_, _mm_set1_epi16(128));
+	return _mm_srli_epi16(_mm_add_epi16(t_, _mm_srli_epi16(t_, 8)), 8);
+}
+
+// Broadcasts the alpha lane of each pixel across its four channel lanes
+// (input: eight 16-bit lanes holding two unpacked pixels).
+inline __m128i broadcastAlphaEpi16(__m128i const pixels_)
+{
+	auto const spread = _mm_shufflelo_epi16(pixels_, _MM_SHUFFLE(3, 3, 3, 3));
+	return _mm_shufflehi_epi16(spread, _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+#endif
+
+} // namespace detail
+
+/// <summary>
+/// Alpha-blends source over destination: out = (src * srcAlpha + dst * (255 - srcAlpha)) / 255.
+/// </summary>
+/// <param name="source_">The source colors (their alpha channel drives the blend).</param>
+/// <param name="destination_">The destination colors.</param>
+/// <param name="out_">The output colors (may alias an input).</param>
+/// <remarks>
+/// <para>The weighting is applied to all four channels, alpha included.</para>
+/// </remarks>
+inline void blend(Span<ColorPacked32 const> source_, Span<ColorPacked32 const> destination_, Span<ColorPacked32> out_)
+{
+	// # Assertion note:
+	// Every span passed to a batch kernel must have the same size. Fix your code.
+	assert(source_.size() == destination_.size() && source_.size() == out_.size());
+
+	auto const* src	= reinterpret_cast<std::uint32_t const*>(source_.data());
+	auto const* dst	= reinterpret_cast<std::uint32_t const*>(destination_.data());
+	auto* out		= reinterpret_cast<std::uint32_t*>(out_.data());
+
+	std::size_t const count = out_.size();
+	std::size_t i = 0;
+#if EDGE_SIMD_SSE
+	{
+		__m128i const zero		= _mm_setzero_si128();
+		__m128i const full		= _mm_set1_epi16(255);
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i const s = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+			__m128i const d = _mm_loadu_si128(reinterpret_cast<__m128i const*>(dst + i));
+
+			__m128i const sLo		= _mm_unpacklo_epi8(s, zero);
+			__m128i const sHi		= _mm_unpackhi_epi8(s, zero);
+			__m128i const dLo		= _mm_unpacklo_epi8(d, zero);
+			__m128i const dHi		= _mm_unpackhi_epi8(d, zero);
+			__m128i const alphaLo	= detail::broadcastAlphaEpi16(sLo);
+			__m128i const alphaHi	= detail::broadcastAlphaEpi16(sHi);
+
+			__m128i const lo = _mm_add_epi16(
+				_mm_mullo_epi16(sLo, alphaLo),
+				_mm_mullo_epi16(dLo, _mm_sub_epi16(full, alphaLo)));
+			__m128i const hi = _mm_add_epi16(
+				_mm_mullo_epi16(sHi, alphaHi),
+				_mm_mullo_epi16(dHi, _mm_sub_epi16(full, alphaHi)));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+				_mm_packus_epi16(detail::div255Epi16(lo), detail::div255Epi16(hi)));
+		}
+	}
+#endif
+	for (; i < count; ++i)
+		out[i] = detail::weighPixel(src[i], dst[i], (src[i] >> 24) & 0xFF);
+}
+
+/// <summary>
+/// Linearly interpolates two color arrays: out = a + (b - a) * alpha / 255.
+/// </summary>
+/// <param name="a_">The lhs colors.</param>
+/// <param name="b_">The rhs colors.</param>
+/// <param name="alpha_">The interpolation factor (0 = a, 255 = b).</param>
+/// <param name="out_">The output colors (may alias an input).</param>
+inline void lerp(Span<ColorPacked32 const> a_, Span<ColorPacked32 const> b_, std::uint8_t const alpha_, Span<ColorPacked32> out_)
+{
+	// # Assertion note:
+	// Every span passed to a batch kernel must have the same size. Fix your code.
+	assert(a_.size() == b_.size() && a_.size() == out_.size());
+
+	auto const* a	= reinterpret_cast<std::uint32_t const*>(a_.data());
+	auto const* b	= reinterpret_cast<std::uint32_t const*>(b_.data());
+	auto* out		= reinterpret_cast<std::uint32_t*>(out_.data());
+
+	std::uint32_t const weightB = alpha_;
+	std::uint32_t const weightA = 255 - weightB;
+
+	std::size_t const count = out_.size();
+	std::size_t i = 0;
+#if EDGE_SIMD_SSE
+	{
+		__m128i const zero	= _mm_setzero_si128();
+		__m128i const wa	= _mm_set1_epi16(static_cast<short>(weightA));
+		__m128i const wb	= _mm_set1_epi16(static_cast<short>(weightB));
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i const va = _mm_loadu_si128(reinterpret_cast<__m128i const*>(a + i));
+			__m128i const vb = _mm_loadu_si128(reinterpret_cast<__m128i const*>(b + i));
+
+			__m128i const lo = _mm_add_epi16(
+				_mm_mullo_epi16(_mm_unpacklo_epi8(va, zero), wa),
+				_mm_mullo_epi16(_mm_unpacklo_epi8(vb, zero), wb));
+			__m128i const hi = _mm_add_epi16(
+				_mm_mullo_epi16(_mm_unpackhi_epi8(va, zero), wa),
+				_mm_mullo_epi16(_mm_unpackhi_epi8(vb, zero), wb));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+				_mm_packus_epi16(detail::div255Epi16(lo), detail::div255Epi16(hi)));
+		}
+	}
+#endif
+	for (; i < count; ++i)
+		out[i] = detail::weighPixel(a[i], b[i], weightA);
+}
+
+/// <summary>
+/// Multiplies two color arrays per channel: out = a * b / 255.
+/// </summary>
+/// <param name="a_">The lhs colors.</param>
+/// <param name="b_">The rhs colors.</param>
+/// <param name="out_">The output colors (may alias an input).</param>
+inline void modulate(Span<ColorPacked32 const> a_, Span<ColorPacked32 const> b_, Span<ColorPacked32> out_)
+{
+	// # Assertion note:
+	// Every span passed to a batch kernel must have the same size. Fix your code.
+	assert(a_.size() == b_.size() && a_.size() == out_.size());
+
+	auto const* a	= reinterpret_cast<std::uint32_t const*>(a_.data());
+	auto const* b	= reinterpret_cast<std::uint32_t const*>(b_.data());
+	auto* out		= reinterpret_cast<std::uint32_t*>(out_.data());
+
+	std::size_t const count = out_.size();
+	std::size_t i = 0;
+#if EDGE_SIMD_SSE
+	{
+		__m128i const zero = _mm_setzero_si128();
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i const va = _mm_loadu_si128(reinterpret_cast<__m128i const*>(a + i));
+			__m128i const vb = _mm_loadu_si128(reinterpret_cast<__m128i const*>(b + i));
+
+			__m128i const lo = _mm_mullo_epi16(_mm_unpacklo_epi8(va, zero), _mm_unpacklo_epi8(vb, zero));
+			__m128i const hi = _mm_mullo_epi16(_mm_unpackhi_epi8(va, zero), _mm_unpackhi_epi8(vb, zero));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+				_mm_packus_epi16(detail::div255Epi16(lo), detail::div255Epi16(hi)));
+		}
+	}
+#endif
+	for (; i < count; ++i)
+		out[i] = detail::modulatePixel(a[i], b[i]);
+}
+
+/// <summary>
+/// Multiplies a color array by a constant tint per channel: out = a * tint / 255.
+/// The one-pass form of layer color grading.
+/// </summary>
+/// <param name="a_">The colors.</param>
+/// <param name="tint_">The tint color.</param>
+/// <param name="out_">The output colors (may alias the input).</param>
+inline void modulate(Span<ColorPacked32 const> a_, ColorPacked32 const tint_, Span<ColorPacked32> out_)
+{
+	// # Assertion note:
+	// Every span passed to a batch kernel must have the same size. Fix your code.
+	assert(a_.size() == out_.size());
+
+	auto const* a	= reinterpret_cast<std::uint32_t const*>(a_.data());
+	auto* out		= reinterpret_cast<std::uint32_t*>(out_.data());
+
+	std::size_t const count = out_.size();
+	std::size_t i = 0;
+#if EDGE_SIMD_SSE
+	{
+		__m128i const zero = _mm_setzero_si128();
+		__m128i const tint = _mm_unpacklo_epi8(
+			_mm_set1_epi32(static_cast<int>(tint_.value)), zero);
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i const va = _mm_loadu_si128(reinterpret_cast<__m128i const*>(a + i));
+
+			__m128i const lo = _mm_mullo_epi16(_mm_unpacklo_epi8(va, zero), tint);
+			__m128i const hi = _mm_mullo_epi16(_mm_unpackhi_epi8(va, zero), tint);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+				_mm_packus_epi16(detail::div255Epi16(lo), detail::div255Epi16(hi)));
+		}
+	}
+#endif
+	for (; i < count; ++i)
+		out[i] = detail::modulatePixel(a[i], tint_.value);
+}
+
+} // namespace color::batch
+
+} // namespace edge
@@ -134,7 +134,7 @@ public:
 	static constexpr ColorSchemeRGBA lazyAverage(ColorSchemeRGBA const & first_, _colors&&... restColors_)
 	{
 		using MaxType = make_widest_t<ValueType>;
-		MaxType avg[NumberOfChannels];
+		MaxType avg[NumberOfChannels] = {};
 
 		for (std::size_t i = 0; i < NumberOfChannels; i++) {
 			avg[i] += first_[i];
@@ -144,10 +144,10 @@ public:
 			avg[i] /= (1 + sizeof...(_colors));
 		}
 		return ColorSchemeRGBA{
-			static_cast<ValueType>(sum[0]),
-			static_cast<ValueType>(sum[1]),
-			static_cast<ValueType>(sum[2]),
-			static_cast<ValueType>(sum[3]) };
+			static_cast<ValueType>(avg[0]),
+			static_cast<ValueType>(avg[1]),
+			static_cast<ValueType>(avg[2]),
+			static_cast<ValueType>(avg[3]) };
 	}
 
 	/// <summary>
@@ -163,8 +163,8 @@ public:
 		// This algorithm uses average of squared components and then takes square root to get final result.
 
 		using MaxType = make_widest_t<ValueType>;
-		MaxType avg[NumberOfChannels];
-		
+		MaxType avg[NumberOfChannels] = {};
+
 		for (std::size_t i = 0; i < NumberOfChannels; i++) {
 			avg[i] += (first_[i] * first_[i]);
 			avg[i] += (... + (restColors_[i] * restColors_[i])); // unfold.
@@ -268,18 +268,25 @@ public:
 	/// <param name="hue_">The hue channel value.</param>
 	/// <param name="saturation_">The saturation channel value.</param>
 	/// <param name="value_">The value channel value.</param>
-	constexpr static ColorSchemeRGBA fromHSV(ValueType const hue_, ValueType const saturation_, ValueType const value_)
+	static ColorSchemeRGBA fromHSV(double const hue_, double const saturation_, double const value_)
 	{
+		// Conversion is always performed in doubles - integer value types can neither
+		// represent the full hue range nor the intermediate 0..1 channel values.
+		double red = 0, green = 0, blue = 0;
+		color::convertHSVtoRGB(hue_, saturation_, value_, red, green, blue);
+
 		ColorSchemeRGBA color{};
-		colors::convertHSVtoRGB(hue_, saturation_, value_, &color.r, &color.g, &color.b);
-		
-		color.r *= MappedMax;
-		color.g *= MappedMax;
-		color.b *= MappedMax;
+		color.r = static_cast<ValueType>(red	* MappedMax);
+		color.g = static_cast<ValueType>(green	* MappedMax);
+		color.b = static_cast<ValueType>(blue	* MappedMax);
 		color.a = MappedMax;
 		return color;
 	}
 
 };
 
+// Explicit instantiation declaration for the canonical 8-bit scheme.
+// Definition lives in src/EDGE/Core/Color/ColorSchemeRGBA.cpp - other TUs don't re-instantiate it.
+extern template class ColorSchemeRGBA<std::uint8_t, 255>;
+
 }
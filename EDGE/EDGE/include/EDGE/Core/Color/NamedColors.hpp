@@ -0,0 +1,811 @@
+// File description:
+// Implements name-based lookup over the edge::colors constants.
+// Included by Color.hpp after the color definitions - do not include directly.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+namespace edge::colors
+{
+	namespace detail
+	{
+		struct NamedColor
+		{
+			std::string_view	name;
+			Color<>				color;
+		};
+
+		// Every named color, sorted byte-wise by name - find() binary-searches this
+		// table, so keep the ordering intact when adding colors.
+		constexpr NamedColor namedColorTable[] = {
+		{ "AirForceblue", AirForceblue },
+		{ "Aliceblue", Aliceblue },
+		{ "Alizarincrimson", Alizarincrimson },
+		{ "Almond", Almond },
+		{ "Amaranth", Amaranth },
+		{ "Amber", Amber },
+		{ "Americanrose", Americanrose },
+		{ "Amethyst", Amethyst },
+		{ "AndroidGreen", AndroidGreen },
+		{ "Antiflashwhite", Antiflashwhite },
+		{ "Antiquebrass", Antiquebrass },
+		{ "Antiquefuchsia", Antiquefuchsia },
+		{ "Antiquewhite", Antiquewhite },
+		{ "Ao", Ao },
+		{ "Applegreen", Applegreen },
+		{ "Apricot", Apricot },
+		{ "Aqua", Aqua },
+		{ "Aquamarine", Aquamarine },
+		{ "Armygreen", Armygreen },
+		{ "Arylideyellow", Arylideyellow },
+		{ "Ashgrey", Ashgrey },
+		{ "Asparagus", Asparagus },
+		{ "Atomictangerine", Atomictangerine },
+		{ "Auburn", Auburn },
+		{ "Aureolin", Aureolin },
+		{ "AuroMetalSaurus", AuroMetalSaurus },
+		{ "Awesome", Awesome },
+		{ "Azure", Azure },
+		{ "Azuremistweb", Azuremistweb },
+		{ "Babyblue", Babyblue },
+		{ "Babyblueeyes", Babyblueeyes },
+		{ "Babypink", Babypink },
+		{ "BallBlue", BallBlue },
+		{ "BananaMania", BananaMania },
+		{ "Bananayellow", Bananayellow },
+		{ "Battleshipgrey", Battleshipgrey },
+		{ "Bazaar", Bazaar },
+		{ "Beaublue", Beaublue },
+		{ "Beaver", Beaver },
+		{ "Beige", Beige },
+		{ "Bisque", Bisque },
+		{ "Bistre", Bistre },
+		{ "Bittersweet", Bittersweet },
+		{ "Black", Black },
+		{ "BlanchedAlmond", BlanchedAlmond },
+		{ "BleudeFrance", BleudeFrance },
+		{ "BlizzardBlue", BlizzardBlue },
+		{ "Blond", Blond },
+		{ "Blue", Blue },
+		{ "BlueBell", BlueBell },
+		{ "BlueGray", BlueGray },
+		{ "Bluegreen", Bluegreen },
+		{ "Bluepurple", Bluepurple },
+		{ "Blueviolet", Blueviolet },
+		{ "Blush", Blush },
+		{ "Bole", Bole },
+		{ "Bondiblue", Bondiblue },
+		{ "Bone", Bone },
+		{ "BostonUniversityRed", BostonUniversityRed },
+		{ "Bottlegreen", Bottlegreen },
+		{ "Boysenberry", Boysenberry },
+		{ "Brandeisblue", Brandeisblue },
+		{ "Brass", Brass },
+		{ "Brickred", Brickred },
+		{ "Brightcerulean", Brightcerulean },
+		{ "Brightgreen", Brightgreen },
+		{ "Brightlavender", Brightlavender },
+		{ "Brightmaroon", Brightmaroon },
+		{ "Brightpink", Brightpink },
+		{ "Brightturquoise", Brightturquoise },
+		{ "Brightube", Brightube },
+		{ "Brilliantlavender", Brilliantlavender },
+		{ "Brilliantrose", Brilliantrose },
+		{ "Brinkpink", Brinkpink },
+		{ "Britishracinggreen", Britishracinggreen },
+		{ "Bronze", Bronze },
+		{ "Brown", Brown },
+		{ "Bubblegum", Bubblegum },
+		{ "Bubbles", Bubbles },
+		{ "Buff", Buff },
+		{ "Bulgarianrose", Bulgarianrose },
+		{ "Burgundy", Burgundy },
+		{ "Burlywood", Burlywood },
+		{ "Burntorange", Burntorange },
+		{ "Burntsienna", Burntsienna },
+		{ "Burntumber", Burntumber },
+		{ "Byzantine", Byzantine },
+		{ "Byzantium", Byzantium },
+		{ "CGBlue", CGBlue },
+		{ "CGRed", CGRed },
+		{ "Cadet", Cadet },
+		{ "Cadetblue", Cadetblue },
+		{ "Cadetgrey", Cadetgrey },
+		{ "Cadmiumgreen", Cadmiumgreen },
+		{ "Cadmiumorange", Cadmiumorange },
+		{ "Cadmiumred", Cadmiumred },
+		{ "Cadmiumyellow", Cadmiumyellow },
+		{ "Cafaulait", Cafaulait },
+		{ "Cafnoir", Cafnoir },
+		{ "CalPolyPomonagreen", CalPolyPomonagreen },
+		{ "CambridgeBlue", CambridgeBlue },
+		{ "Camel", Camel },
+		{ "Camouflagegreen", Camouflagegreen },
+		{ "Canary", Canary },
+		{ "Canaryyellow", Canaryyellow },
+		{ "Candyapplered", Candyapplered },
+		{ "Candypink", Candypink },
+		{ "Capri", Capri },
+		{ "Caputmortuum", Caputmortuum },
+		{ "Cardinal", Cardinal },
+		{ "Caribbeangreen", Caribbeangreen },
+		{ "Carmine", Carmine },
+		{ "Carminepink", Carminepink },
+		{ "Carminered", Carminered },
+		{ "Carnationpink", Carnationpink },
+		{ "Carnelian", Carnelian },
+		{ "Carolinablue", Carolinablue },
+		{ "Carrotorange", Carrotorange },
+		{ "Celadon", Celadon },
+		{ "Celeste", Celeste },
+		{ "Celestialblue", Celestialblue },
+		{ "Cerise", Cerise },
+		{ "Cerisepink", Cerisepink },
+		{ "Cerulean", Cerulean },
+		{ "Ceruleanblue", Ceruleanblue },
+		{ "Chamoisee", Chamoisee },
+		{ "Champagne", Champagne },
+		{ "Charcoal", Charcoal },
+		{ "Chartreuse", Chartreuse },
+		{ "Cherry", Cherry },
+		{ "Cherryblossompink", Cherryblossompink },
+		{ "Chestnut", Chestnut },
+		{ "Chocolate", Chocolate },
+		{ "Chromeyellow", Chromeyellow },
+		{ "Cinereous", Cinereous },
+		{ "Cinnabar", Cinnabar },
+		{ "Cinnamon", Cinnamon },
+		{ "Citrine", Citrine },
+		{ "Classicrose", Classicrose },
+		{ "Cobalt", Cobalt },
+		{ "Cocoabrown", Cocoabrown },
+		{ "Coffee", Coffee },
+		{ "Columbiablue", Columbiablue },
+		{ "Coolblack", Coolblack },
+		{ "Coolgrey", Coolgrey },
+		{ "Copper", Copper },
+		{ "Copperrose", Copperrose },
+		{ "Coquelicot", Coquelicot },
+		{ "Coral", Coral },
+		{ "Coralpink", Coralpink },
+		{ "Coralred", Coralred },
+		{ "Cordovan", Cordovan },
+		{ "Corn", Corn },
+		{ "CornellRed", CornellRed },
+		{ "Cornflower", Cornflower },
+		{ "Cornflowerblue", Cornflowerblue },
+		{ "Cornsilk", Cornsilk },
+		{ "Cosmiclatte", Cosmiclatte },
+		{ "Cottoncandy", Cottoncandy },
+		{ "Cream", Cream },
+		{ "Crimson", Crimson },
+		{ "CrimsonRed", CrimsonRed },
+		{ "Crimsonglory", Crimsonglory },
+		{ "Cyan", Cyan },
+		{ "Daffodil", Daffodil },
+		{ "Dandelion", Dandelion },
+		{ "Darkblue", Darkblue },
+		{ "Darkbrown", Darkbrown },
+		{ "Darkbyzantium", Darkbyzantium },
+		{ "Darkcandyapplered", Darkcandyapplered },
+		{ "Darkcerulean", Darkcerulean },
+		{ "Darkchestnut", Darkchestnut },
+		{ "Darkcoral", Darkcoral },
+		{ "Darkcyan", Darkcyan },
+		{ "Darkelectricblue", Darkelectricblue },
+		{ "Darkgoldenrod", Darkgoldenrod },
+		{ "Darkgray", Darkgray },
+		{ "Darkgreen", Darkgreen },
+		{ "Darkjunglegreen", Darkjunglegreen },
+		{ "Darkkhaki", Darkkhaki },
+		{ "Darklava", Darklava },
+		{ "Darklavender", Darklavender },
+		{ "Darkmagenta", Darkmagenta },
+		{ "Darkmidnightblue", Darkmidnightblue },
+		{ "Darkolivegreen", Darkolivegreen },
+		{ "Darkorange", Darkorange },
+		{ "Darkorchid", Darkorchid },
+		{ "Darkpastelblue", Darkpastelblue },
+		{ "Darkpastelgreen", Darkpastelgreen },
+		{ "Darkpastelpurple", Darkpastelpurple },
+		{ "Darkpastelred", Darkpastelred },
+		{ "Darkpink", Darkpink },
+		{ "Darkpowderblue", Darkpowderblue },
+		{ "Darkraspberry", Darkraspberry },
+		{ "Darkred", Darkred },
+		{ "Darksalmon", Darksalmon },
+		{ "Darkscarlet", Darkscarlet },
+		{ "Darkseagreen", Darkseagreen },
+		{ "Darksienna", Darksienna },
+		{ "Darkslateblue", Darkslateblue },
+		{ "Darkslategray", Darkslategray },
+		{ "Darkspringgreen", Darkspringgreen },
+		{ "Darktan", Darktan },
+		{ "Darktangerine", Darktangerine },
+		{ "Darktaupe", Darktaupe },
+		{ "Darkterracotta", Darkterracotta },
+		{ "Darkturquoise", Darkturquoise },
+		{ "Darkviolet", Darkviolet },
+		{ "Dartmouthgreen", Dartmouthgreen },
+		{ "Davygrey", Davygrey },
+		{ "Debianred", Debianred },
+		{ "Deepcarmine", Deepcarmine },
+		{ "Deepcarminepink", Deepcarminepink },
+		{ "Deepcarrotorange", Deepcarrotorange },
+		{ "Deepcerise", Deepcerise },
+		{ "Deepchampagne", Deepchampagne },
+		{ "Deepchestnut", Deepchestnut },
+		{ "Deepcoffee", Deepcoffee },
+		{ "Deepfuchsia", Deepfuchsia },
+		{ "Deepjunglegreen", Deepjunglegreen },
+		{ "Deeplilac", Deeplilac },
+		{ "Deepmagenta", Deepmagenta },
+		{ "Deeppeach", Deeppeach },
+		{ "Deeppink", Deeppink },
+		{ "Deepsaffron", Deepsaffron },
+		{ "Deepskyblue", Deepskyblue },
+		{ "Denim", Denim },
+		{ "Desert", Desert },
+		{ "Desertsand", Desertsand },
+		{ "Dimgray", Dimgray },
+		{ "Dodgerblue", Dodgerblue },
+		{ "Dogwoodrose", Dogwoodrose },
+		{ "Dollarbill", Dollarbill },
+		{ "Drab", Drab },
+		{ "Dukeblue", Dukeblue },
+		{ "Earthyellow", Earthyellow },
+		{ "Ecru", Ecru },
+		{ "Eggplant", Eggplant },
+		{ "Eggshell", Eggshell },
+		{ "Egyptianblue", Egyptianblue },
+		{ "Electricblue", Electricblue },
+		{ "Electriccrimson", Electriccrimson },
+		{ "Electriccyan", Electriccyan },
+		{ "Electricgreen", Electricgreen },
+		{ "Electricindigo", Electricindigo },
+		{ "Electriclavender", Electriclavender },
+		{ "Electriclime", Electriclime },
+		{ "Electricpurple", Electricpurple },
+		{ "Electricultramarine", Electricultramarine },
+		{ "Electricviolet", Electricviolet },
+		{ "Electricyellow", Electricyellow },
+		{ "Emerald", Emerald },
+		{ "Etonblue", Etonblue },
+		{ "Fallow", Fallow },
+		{ "Falured", Falured },
+		{ "Famous", Famous },
+		{ "Fandango", Fandango },
+		{ "Fashionfuchsia", Fashionfuchsia },
+		{ "Fawn", Fawn },
+		{ "Feldgrau", Feldgrau },
+		{ "Fern", Fern },
+		{ "Ferngreen", Ferngreen },
+		{ "FerrariRed", FerrariRed },
+		{ "Fielddrab", Fielddrab },
+		{ "Firebrick", Firebrick },
+		{ "Fireenginered", Fireenginered },
+		{ "Flame", Flame },
+		{ "Flamingopink", Flamingopink },
+		{ "Flavescent", Flavescent },
+		{ "Flax", Flax },
+		{ "Floralwhite", Floralwhite },
+		{ "Fluorescentorange", Fluorescentorange },
+		{ "Fluorescentpink", Fluorescentpink },
+		{ "Fluorescentyellow", Fluorescentyellow },
+		{ "Folly", Folly },
+		{ "Forestgreen", Forestgreen },
+		{ "Frenchbeige", Frenchbeige },
+		{ "Frenchblue", Frenchblue },
+		{ "Frenchlilac", Frenchlilac },
+		{ "Frenchrose", Frenchrose },
+		{ "Fuchsia", Fuchsia },
+		{ "Fuchsiapink", Fuchsiapink },
+		{ "Fulvous", Fulvous },
+		{ "FuzzyWuzzy", FuzzyWuzzy },
+		{ "Gainsboro", Gainsboro },
+		{ "Gamboge", Gamboge },
+		{ "Ghostwhite", Ghostwhite },
+		{ "Ginger", Ginger },
+		{ "Glaucous", Glaucous },
+		{ "Glitter", Glitter },
+		{ "Gold", Gold },
+		{ "Goldenbrown", Goldenbrown },
+		{ "Goldenpoppy", Goldenpoppy },
+		{ "Goldenrod", Goldenrod },
+		{ "Goldenyellow", Goldenyellow },
+		{ "GrannySmithApple", GrannySmithApple },
+		{ "Gray", Gray },
+		{ "Grayasparagus", Grayasparagus },
+		{ "Green", Green },
+		{ "GreenBlue", GreenBlue },
+		{ "Greenyellow", Greenyellow },
+		{ "Grullo", Grullo },
+		{ "Guppiegreen", Guppiegreen },
+		{ "Halaybe", Halaybe },
+		{ "Hanblue", Hanblue },
+		{ "Hanpurple", Hanpurple },
+		{ "Hansayellow", Hansayellow },
+		{ "Harlequin", Harlequin },
+		{ "Harvardcrimson", Harvardcrimson },
+		{ "HarvestGold", HarvestGold },
+		{ "HeartGold", HeartGold },
+		{ "Heliotrope", Heliotrope },
+		{ "Hollywoodcerise", Hollywoodcerise },
+		{ "Honeydew", Honeydew },
+		{ "Hookergreen", Hookergreen },
+		{ "Hotmagenta", Hotmagenta },
+		{ "Hotpink", Hotpink },
+		{ "Huntergreen", Huntergreen },
+		{ "Icterine", Icterine },
+		{ "Inchworm", Inchworm },
+		{ "Indiagreen", Indiagreen },
+		{ "Indianred", Indianred },
+		{ "Indianyellow", Indianyellow },
+		{ "Indigo", Indigo },
+		{ "InternationalKleinBlue", InternationalKleinBlue },
+		{ "Internationalorange", Internationalorange },
+		{ "Iris", Iris },
+		{ "Isabelline", Isabelline },
+		{ "Islamicgreen", Islamicgreen },
+		{ "Ivory", Ivory },
+		{ "Jade", Jade },
+		{ "Jasmine", Jasmine },
+		{ "Jasper", Jasper },
+		{ "Jazzberryjam", Jazzberryjam },
+		{ "Jonquil", Jonquil },
+		{ "Junebud", Junebud },
+		{ "Junglegreen", Junglegreen },
+		{ "KUCrimson", KUCrimson },
+		{ "Kellygreen", Kellygreen },
+		{ "Khaki", Khaki },
+		{ "LaSalleGreen", LaSalleGreen },
+		{ "Languidlavender", Languidlavender },
+		{ "Lapislazuli", Lapislazuli },
+		{ "LaserLemon", LaserLemon },
+		{ "Laurelgreen", Laurelgreen },
+		{ "Lava", Lava },
+		{ "Lavender", Lavender },
+		{ "Lavenderblue", Lavenderblue },
+		{ "Lavenderblush", Lavenderblush },
+		{ "Lavendergray", Lavendergray },
+		{ "Lavenderindigo", Lavenderindigo },
+		{ "Lavendermagenta", Lavendermagenta },
+		{ "Lavendermist", Lavendermist },
+		{ "Lavenderpink", Lavenderpink },
+		{ "Lavenderpurple", Lavenderpurple },
+		{ "Lavenderrose", Lavenderrose },
+		{ "Lawngreen", Lawngreen },
+		{ "Lemon", Lemon },
+		{ "LemonYellow", LemonYellow },
+		{ "Lemonchiffon", Lemonchiffon },
+		{ "Lemonlime", Lemonlime },
+		{ "LightCrimson", LightCrimson },
+		{ "LightThulianpink", LightThulianpink },
+		{ "Lightapricot", Lightapricot },
+		{ "Lightblue", Lightblue },
+		{ "Lightbrown", Lightbrown },
+		{ "Lightcarminepink", Lightcarminepink },
+		{ "Lightcoral", Lightcoral },
+		{ "Lightcornflowerblue", Lightcornflowerblue },
+		{ "Lightcyan", Lightcyan },
+		{ "Lightfuchsiapink", Lightfuchsiapink },
+		{ "Lightgoldenrodyellow", Lightgoldenrodyellow },
+		{ "Lightgray", Lightgray },
+		{ "Lightgreen", Lightgreen },
+		{ "Lightkhaki", Lightkhaki },
+		{ "Lightpastelpurple", Lightpastelpurple },
+		{ "Lightpink", Lightpink },
+		{ "Lightsalmon", Lightsalmon },
+		{ "Lightsalmonpink", Lightsalmonpink },
+		{ "Lightseagreen", Lightseagreen },
+		{ "Lightskyblue", Lightskyblue },
+		{ "Lightslategray", Lightslategray },
+		{ "Lighttaupe", Lighttaupe },
+		{ "Lightyellow", Lightyellow },
+		{ "Lilac", Lilac },
+		{ "Lime", Lime },
+		{ "Limegreen", Limegreen },
+		{ "Lincolngreen", Lincolngreen },
+		{ "Linen", Linen },
+		{ "Lion", Lion },
+		{ "Liver", Liver },
+		{ "Lust", Lust },
+		{ "MSUGreen", MSUGreen },
+		{ "MacaroniandCheese", MacaroniandCheese },
+		{ "Magenta", Magenta },
+		{ "Magicmint", Magicmint },
+		{ "Magnolia", Magnolia },
+		{ "Mahogany", Mahogany },
+		{ "Maize", Maize },
+		{ "MajorelleBlue", MajorelleBlue },
+		{ "Malachite", Malachite },
+		{ "Manatee", Manatee },
+		{ "MangoTango", MangoTango },
+		{ "Mantis", Mantis },
+		{ "Maroon", Maroon },
+		{ "Mauve", Mauve },
+		{ "Mauvelous", Mauvelous },
+		{ "Mauvetaupe", Mauvetaupe },
+		{ "Mayablue", Mayablue },
+		{ "Meatbrown", Meatbrown },
+		{ "MediumPersianblue", MediumPersianblue },
+		{ "Mediumaquamarine", Mediumaquamarine },
+		{ "Mediumblue", Mediumblue },
+		{ "Mediumcandyapplered", Mediumcandyapplered },
+		{ "Mediumcarmine", Mediumcarmine },
+		{ "Mediumchampagne", Mediumchampagne },
+		{ "Mediumelectricblue", Mediumelectricblue },
+		{ "Mediumjunglegreen", Mediumjunglegreen },
+		{ "Mediumlavendermagenta", Mediumlavendermagenta },
+		{ "Mediumorchid", Mediumorchid },
+		{ "Mediumpurple", Mediumpurple },
+		{ "Mediumredviolet", Mediumredviolet },
+		{ "Mediumseagreen", Mediumseagreen },
+		{ "Mediumslateblue", Mediumslateblue },
+		{ "Mediumspringbud", Mediumspringbud },
+		{ "Mediumspringgreen", Mediumspringgreen },
+		{ "Mediumtaupe", Mediumtaupe },
+		{ "Mediumtealblue", Mediumtealblue },
+		{ "Mediumturquoise", Mediumturquoise },
+		{ "Mediumvioletred", Mediumvioletred },
+		{ "Melon", Melon },
+		{ "Midnightblue", Midnightblue },
+		{ "Midnightgreen", Midnightgreen },
+		{ "Mikadoyellow", Mikadoyellow },
+		{ "Mint", Mint },
+		{ "Mintcream", Mintcream },
+		{ "Mintgreen", Mintgreen },
+		{ "Mistyrose", Mistyrose },
+		{ "Moccasin", Moccasin },
+		{ "Modebeige", Modebeige },
+		{ "Moonstoneblue", Moonstoneblue },
+		{ "Mordantred", Mordantred },
+		{ "Mossgreen", Mossgreen },
+		{ "MountainMeadow", MountainMeadow },
+		{ "Mountbattenpink", Mountbattenpink },
+		{ "Mulberry", Mulberry },
+		{ "Munsell", Munsell },
+		{ "Mustard", Mustard },
+		{ "Myrtle", Myrtle },
+		{ "Nadeshikopink", Nadeshikopink },
+		{ "Napiergreen", Napiergreen },
+		{ "Naplesyellow", Naplesyellow },
+		{ "Navajowhite", Navajowhite },
+		{ "Navyblue", Navyblue },
+		{ "NeonCarrot", NeonCarrot },
+		{ "Neonfuchsia", Neonfuchsia },
+		{ "Neongreen", Neongreen },
+		{ "Nonphotoblue", Nonphotoblue },
+		{ "NorthTexasGreen", NorthTexasGreen },
+		{ "OceanBoatBlue", OceanBoatBlue },
+		{ "Ochre", Ochre },
+		{ "Officegreen", Officegreen },
+		{ "Oldgold", Oldgold },
+		{ "Oldlace", Oldlace },
+		{ "Oldlavender", Oldlavender },
+		{ "Oldmauve", Oldmauve },
+		{ "Oldrose", Oldrose },
+		{ "Olive", Olive },
+		{ "OliveDrab", OliveDrab },
+		{ "OliveGreen", OliveGreen },
+		{ "Olivine", Olivine },
+		{ "Onyx", Onyx },
+		{ "Operamauve", Operamauve },
+		{ "Orange", Orange },
+		{ "OrangeYellow", OrangeYellow },
+		{ "Orangepeel", Orangepeel },
+		{ "Orangered", Orangered },
+		{ "Orchid", Orchid },
+		{ "Otterbrown", Otterbrown },
+		{ "OuterSpace", OuterSpace },
+		{ "OutrageousOrange", OutrageousOrange },
+		{ "OxfordBlue", OxfordBlue },
+		{ "PacificBlue", PacificBlue },
+		{ "Pakistangreen", Pakistangreen },
+		{ "Palatinateblue", Palatinateblue },
+		{ "Palatinatepurple", Palatinatepurple },
+		{ "Paleaqua", Paleaqua },
+		{ "Paleblue", Paleblue },
+		{ "Palebrown", Palebrown },
+		{ "Palecarmine", Palecarmine },
+		{ "Palecerulean", Palecerulean },
+		{ "Palechestnut", Palechestnut },
+		{ "Palecopper", Palecopper },
+		{ "Palecornflowerblue", Palecornflowerblue },
+		{ "Palegold", Palegold },
+		{ "Palegoldenrod", Palegoldenrod },
+		{ "Palegreen", Palegreen },
+		{ "Palelavender", Palelavender },
+		{ "Palemagenta", Palemagenta },
+		{ "Palepink", Palepink },
+		{ "Paleplum", Paleplum },
+		{ "Paleredviolet", Paleredviolet },
+		{ "Palerobineggblue", Palerobineggblue },
+		{ "Palesilver", Palesilver },
+		{ "Palespringbud", Palespringbud },
+		{ "Paletaupe", Paletaupe },
+		{ "Palevioletred", Palevioletred },
+		{ "Pansypurple", Pansypurple },
+		{ "Papayawhip", Papayawhip },
+		{ "ParisGreen", ParisGreen },
+		{ "Pastelblue", Pastelblue },
+		{ "Pastelbrown", Pastelbrown },
+		{ "Pastelgray", Pastelgray },
+		{ "Pastelgreen", Pastelgreen },
+		{ "Pastelmagenta", Pastelmagenta },
+		{ "Pastelorange", Pastelorange },
+		{ "Pastelpink", Pastelpink },
+		{ "Pastelpurple", Pastelpurple },
+		{ "Pastelred", Pastelred },
+		{ "Pastelviolet", Pastelviolet },
+		{ "Pastelyellow", Pastelyellow },
+		{ "Patriarch", Patriarch },
+		{ "Paynegrey", Paynegrey },
+		{ "Peach", Peach },
+		{ "Peachpuff", Peachpuff },
+		{ "Peachyellow", Peachyellow },
+		{ "Pear", Pear },
+		{ "Pearl", Pearl },
+		{ "PearlAqua", PearlAqua },
+		{ "Peridot", Peridot },
+		{ "Periwinkle", Periwinkle },
+		{ "Persianblue", Persianblue },
+		{ "Persianindigo", Persianindigo },
+		{ "Persianorange", Persianorange },
+		{ "Persianpink", Persianpink },
+		{ "Persianplum", Persianplum },
+		{ "Persianred", Persianred },
+		{ "Persianrose", Persianrose },
+		{ "Phlox", Phlox },
+		{ "Phthaloblue", Phthaloblue },
+		{ "Phthalogreen", Phthalogreen },
+		{ "Piggypink", Piggypink },
+		{ "Pinegreen", Pinegreen },
+		{ "Pink", Pink },
+		{ "PinkFlamingo", PinkFlamingo },
+		{ "PinkSherbet", PinkSherbet },
+		{ "Pinkpearl", Pinkpearl },
+		{ "Pistachio", Pistachio },
+		{ "Platinum", Platinum },
+		{ "Plum", Plum },
+		{ "PortlandOrange", PortlandOrange },
+		{ "Powderblue", Powderblue },
+		{ "Princetonorange", Princetonorange },
+		{ "Prussianblue", Prussianblue },
+		{ "Psychedelicpurple", Psychedelicpurple },
+		{ "Puce", Puce },
+		{ "Pumpkin", Pumpkin },
+		{ "Purple", Purple },
+		{ "PurpleHeart", PurpleHeart },
+		{ "PurpleMountainsMajesty", PurpleMountainsMajesty },
+		{ "Purplemountainmajesty", Purplemountainmajesty },
+		{ "Purplepizzazz", Purplepizzazz },
+		{ "Purpletaupe", Purpletaupe },
+		{ "Rackley", Rackley },
+		{ "RadicalRed", RadicalRed },
+		{ "Raspberry", Raspberry },
+		{ "Raspberryglace", Raspberryglace },
+		{ "Raspberrypink", Raspberrypink },
+		{ "Raspberryrose", Raspberryrose },
+		{ "RawSienna", RawSienna },
+		{ "Razzledazzlerose", Razzledazzlerose },
+		{ "Razzmatazz", Razzmatazz },
+		{ "Red", Red },
+		{ "RedOrange", RedOrange },
+		{ "Redbrown", Redbrown },
+		{ "Redviolet", Redviolet },
+		{ "Richblack", Richblack },
+		{ "Richcarmine", Richcarmine },
+		{ "Richelectricblue", Richelectricblue },
+		{ "Richlilac", Richlilac },
+		{ "Richmaroon", Richmaroon },
+		{ "Riflegreen", Riflegreen },
+		{ "RobinsEggBlue", RobinsEggBlue },
+		{ "Rose", Rose },
+		{ "Rosebonbon", Rosebonbon },
+		{ "Roseebony", Roseebony },
+		{ "Rosegold", Rosegold },
+		{ "Rosemadder", Rosemadder },
+		{ "Rosepink", Rosepink },
+		{ "Rosequartz", Rosequartz },
+		{ "Rosetaupe", Rosetaupe },
+		{ "Rosevale", Rosevale },
+		{ "Rosewood", Rosewood },
+		{ "Rossocorsa", Rossocorsa },
+		{ "Rosybrown", Rosybrown },
+		{ "Royalazure", Royalazure },
+		{ "Royalblue", Royalblue },
+		{ "Royalfuchsia", Royalfuchsia },
+		{ "Royalpurple", Royalpurple },
+		{ "Ruby", Ruby },
+		{ "Ruddy", Ruddy },
+		{ "Ruddybrown", Ruddybrown },
+		{ "Ruddypink", Ruddypink },
+		{ "Rufous", Rufous },
+		{ "Russet", Russet },
+		{ "Rust", Rust },
+		{ "SacramentoStategreen", SacramentoStategreen },
+		{ "Saddlebrown", Saddlebrown },
+		{ "Safetyorange", Safetyorange },
+		{ "Saffron", Saffron },
+		{ "SaintPatrickBlue", SaintPatrickBlue },
+		{ "Salmon", Salmon },
+		{ "Salmonpink", Salmonpink },
+		{ "Sand", Sand },
+		{ "Sanddune", Sanddune },
+		{ "Sandstorm", Sandstorm },
+		{ "Sandybrown", Sandybrown },
+		{ "Sandytaupe", Sandytaupe },
+		{ "Sapgreen", Sapgreen },
+		{ "Sapphire", Sapphire },
+		{ "Satinsheengold", Satinsheengold },
+		{ "Scarlet", Scarlet },
+		{ "Schoolbusyellow", Schoolbusyellow },
+		{ "ScreaminGreen", ScreaminGreen },
+		{ "Seablue", Seablue },
+		{ "Seagreen", Seagreen },
+		{ "Sealbrown", Sealbrown },
+		{ "Seashell", Seashell },
+		{ "Selectiveyellow", Selectiveyellow },
+		{ "Sepia", Sepia },
+		{ "Shadow", Shadow },
+		{ "Shamrock", Shamrock },
+		{ "Shamrockgreen", Shamrockgreen },
+		{ "Shockingpink", Shockingpink },
+		{ "Sienna", Sienna },
+		{ "Silver", Silver },
+		{ "Sinopia", Sinopia },
+		{ "Skobeloff", Skobeloff },
+		{ "Skyblue", Skyblue },
+		{ "Skymagenta", Skymagenta },
+		{ "Slateblue", Slateblue },
+		{ "Slategray", Slategray },
+		{ "Smalt", Smalt },
+		{ "Smokeytopaz", Smokeytopaz },
+		{ "Smokyblack", Smokyblack },
+		{ "Snow", Snow },
+		{ "SpiroDiscoBall", SpiroDiscoBall },
+		{ "Springbud", Springbud },
+		{ "Springgreen", Springgreen },
+		{ "Steelblue", Steelblue },
+		{ "Stildegrainyellow", Stildegrainyellow },
+		{ "Stizza", Stizza },
+		{ "Stormcloud", Stormcloud },
+		{ "Straw", Straw },
+		{ "Sunglow", Sunglow },
+		{ "Sunset", Sunset },
+		{ "SunsetOrange", SunsetOrange },
+		{ "Tan", Tan },
+		{ "Tangelo", Tangelo },
+		{ "Tangerine", Tangerine },
+		{ "Tangerineyellow", Tangerineyellow },
+		{ "Taupe", Taupe },
+		{ "Taupegray", Taupegray },
+		{ "Tawny", Tawny },
+		{ "Teagreen", Teagreen },
+		{ "Teal", Teal },
+		{ "Tealblue", Tealblue },
+		{ "Tealgreen", Tealgreen },
+		{ "Tearose", Tearose },
+		{ "Terracotta", Terracotta },
+		{ "Thistle", Thistle },
+		{ "Thulianpink", Thulianpink },
+		{ "TickleMePink", TickleMePink },
+		{ "TiffanyBlue", TiffanyBlue },
+		{ "Tigereye", Tigereye },
+		{ "Timberwolf", Timberwolf },
+		{ "Titaniumyellow", Titaniumyellow },
+		{ "Tomato", Tomato },
+		{ "Toolbox", Toolbox },
+		{ "Topaz", Topaz },
+		{ "Tractorred", Tractorred },
+		{ "TrolleyGrey", TrolleyGrey },
+		{ "Tropicalrainforest", Tropicalrainforest },
+		{ "TrueBlue", TrueBlue },
+		{ "TuftsBlue", TuftsBlue },
+		{ "Tumbleweed", Tumbleweed },
+		{ "Turkishrose", Turkishrose },
+		{ "Turquoise", Turquoise },
+		{ "Turquoiseblue", Turquoiseblue },
+		{ "Turquoisegreen", Turquoisegreen },
+		{ "Tuscanred", Tuscanred },
+		{ "Twilightlavender", Twilightlavender },
+		{ "Tyrianpurple", Tyrianpurple },
+		{ "UAblue", UAblue },
+		{ "UAred", UAred },
+		{ "UCLABlue", UCLABlue },
+		{ "UCLAGold", UCLAGold },
+		{ "UFOGreen", UFOGreen },
+		{ "UPForestgreen", UPForestgreen },
+		{ "UPMaroon", UPMaroon },
+		{ "USCCardinal", USCCardinal },
+		{ "USCGold", USCGold },
+		{ "Ube", Ube },
+		{ "Ultramarine", Ultramarine },
+		{ "Ultramarineblue", Ultramarineblue },
+		{ "Ultrapink", Ultrapink },
+		{ "Umber", Umber },
+		{ "UnitedNationsblue", UnitedNationsblue },
+		{ "UniversityofCaliforniaGold", UniversityofCaliforniaGold },
+		{ "UnmellowYellow", UnmellowYellow },
+		{ "Upsdellred", Upsdellred },
+		{ "Urobilin", Urobilin },
+		{ "UtahCrimson", UtahCrimson },
+		{ "Vanilla", Vanilla },
+		{ "Vegasgold", Vegasgold },
+		{ "Venetianred", Venetianred },
+		{ "Verdigris", Verdigris },
+		{ "Vermilion", Vermilion },
+		{ "Veronica", Veronica },
+		{ "Violet", Violet },
+		{ "VioletBlue", VioletBlue },
+		{ "VioletRed", VioletRed },
+		{ "Viridian", Viridian },
+		{ "Vividauburn", Vividauburn },
+		{ "Vividburgundy", Vividburgundy },
+		{ "Vividcerise", Vividcerise },
+		{ "Vividtangerine", Vividtangerine },
+		{ "Vividviolet", Vividviolet },
+		{ "Warmblack", Warmblack },
+		{ "Waterspout", Waterspout },
+		{ "Wenge", Wenge },
+		{ "Wheat", Wheat },
+		{ "White", White },
+		{ "Whitesmoke", Whitesmoke },
+		{ "WildStrawberry", WildStrawberry },
+		{ "WildWatermelon", WildWatermelon },
+		{ "Wildblueyonder", Wildblueyonder },
+		{ "Wine", Wine },
+		{ "Wisteria", Wisteria },
+		{ "Xanadu", Xanadu },
+		{ "YaleBlue", YaleBlue },
+		{ "Yellow", Yellow },
+		{ "YellowOrange", YellowOrange },
+		{ "Yellowgreen", Yellowgreen },
+		{ "Zaffre", Zaffre },
+		{ "Zinnwalditebrown", Zinnwalditebrown },
+		};
+
+		constexpr std::size_t namedColorCount = sizeof(namedColorTable) / sizeof(namedColorTable[0]);
+
+		// Compile-time guard for the ordering invariant find() relies on.
+		constexpr bool isNamedColorTableSorted()
+		{
+			for (std::size_t i = 1; i < namedColorCount; i++)
+				if (!(namedColorTable[i - 1].name < namedColorTable[i].name))
+					return false;
+			return true;
+		}
+		static_assert(isNamedColorTableSorted(), "The named color table must stay sorted by name.");
+	}
+
+	/// <summary>
+	/// Resolves a built-in color by its identifier, e.g. find("Amber") == colors::Amber.
+	/// </summary>
+	/// <param name="name_">The color name (case sensitive, matching the constant identifiers).</param>
+	/// <returns>The color, or an empty optional when no constant has that name.</returns>
+	/// <remarks>
+	/// <para>
+	///		Binary search over a frozen constexpr table - around ten probes, no startup
+	///		cost and no allocation, so config and theme loaders need no registry of
+	///		their own. Usable in constant expressions.
+	/// </para>
+	/// </remarks>
+	constexpr std::optional<Color<>> find(std::string_view const name_)
+	{
+		std::size_t low = 0, high = detail::namedColorCount;
+		while (low < high)
+		{
+			std::size_t const mid = low + (high - low) / 2;
+			if (detail::namedColorTable[mid].name < name_)
+				low = mid + 1;
+			else
+				high = mid;
+		}
+		if (low < detail::namedColorCount && detail::namedColorTable[low].name == name_)
+			return detail::namedColorTable[low].color;
+		return std::nullopt;
+	}
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <EDGE/Core/Concurrency/ConcurrentQueue.hpp>
+#include <EDGE/Core/Concurrency/JobSystem.hpp>
+#include <EDGE/Core/Concurrency/Task.hpp>
@@ -0,0 +1,161 @@
+// File description:
+// Implements a bounded lock-free concurrent queue (Vyukov's bounded MPMC algorithm).
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/NonCopyable.hpp>
+
+namespace edge
+{
+
+/// <summary>
+/// Bounded lock-free FIFO queue for passing values between threads.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Implements Dmitry Vyukov's bounded MPMC algorithm: every cell carries a
+///		sequence counter, so producers and consumers synchronize on their own cell
+///		without locking. Any number of producer and consumer threads is allowed;
+///		enqueue/dequeue fail (return <c>false</c>) instead of blocking when the
+///		queue is full/empty - the capacity is fixed at construction.
+/// </para>
+/// </remarks>
+template <typename _type>
+class BoundedConcurrentQueue
+	: INonCopyable
+{
+public:
+	// Helper typedefs:
+	using ValueType	= _type;
+	using SizeType	= std::size_t;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="BoundedConcurrentQueue"/> class.
+	/// </summary>
+	/// <param name="capacity_">Requested capacity (rounded up to a power of two, at least 2).</param>
+	explicit BoundedConcurrentQueue(SizeType const capacity_)
+		:
+		m_mask{ roundUpToPowerOfTwo(std::max<SizeType>(capacity_, 2)) - 1 },
+		m_cells{ std::make_unique<Cell[]>(m_mask + 1) },
+		m_enqueuePos{ 0 },
+		m_dequeuePos{ 0 }
+	{
+		for (SizeType i = 0; i <= m_mask; i++)
+			m_cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	/// <summary>
+	/// Finalizes an instance of the <see cref="BoundedConcurrentQueue"/> class. Destroys values still queued.
+	/// </summary>
+	~BoundedConcurrentQueue()
+	{
+		ValueType drained;
+		while (this->tryDequeue(drained));
+	}
+
+	/// <summary>
+	/// Tries to push a value to the back of the queue. Never blocks.
+	/// </summary>
+	/// <param name="value_">The value (moved into the queue on success).</param>
+	/// <returns><c>true</c> if the value was enqueued; <c>false</c> if the queue is full.</returns>
+	bool tryEnqueue(ValueType value_)
+	{
+		Cell* cell;
+		SizeType pos = m_enqueuePos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			cell = &m_cells[pos & m_mask];
+			SizeType const seq	= cell->sequence.load(std::memory_order_acquire);
+			auto const diff		= static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+			if (diff == 0)
+			{
+				// The cell is free - try to claim it.
+				if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+				return false; // The cell still holds an unconsumed value - queue is full.
+			else
+				pos = m_enqueuePos.load(std::memory_order_relaxed);
+		}
+		new (static_cast<void*>(&cell->storage)) ValueType( std::move(value_) );
+		cell->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// <summary>
+	/// Tries to pop a value from the front of the queue. Never blocks.
+	/// </summary>
+	/// <param name="value_">[out] Receives the dequeued value on success.</param>
+	/// <returns><c>true</c> if a value was dequeued; <c>false</c> if the queue is empty.</returns>
+	bool tryDequeue(ValueType& value_)
+	{
+		Cell* cell;
+		SizeType pos = m_dequeuePos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			cell = &m_cells[pos & m_mask];
+			SizeType const seq	= cell->sequence.load(std::memory_order_acquire);
+			auto const diff		= static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+			if (diff == 0)
+			{
+				// The cell holds a published value - try to claim it.
+				if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+				return false; // No producer published this cell yet - queue is empty.
+			else
+				pos = m_dequeuePos.load(std::memory_order_relaxed);
+		}
+		auto* stored = reinterpret_cast<ValueType*>(&cell->storage);
+		value_ = std::move(*stored);
+		stored->~ValueType();
+		cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// <summary>
+	/// Returns the fixed capacity of the queue.
+	/// </summary>
+	/// <returns>Capacity of the queue.</returns>
+	SizeType capacity() const {
+		return m_mask + 1;
+	}
+
+private:
+
+	/// <summary>
+	/// Rounds the value up to the nearest power of two.
+	/// </summary>
+	/// <param name="value_">The value.</param>
+	/// <returns>Nearest power of two that is >= value_.</returns>
+	constexpr static SizeType roundUpToPowerOfTwo(SizeType value_)
+	{
+		SizeType result = 1;
+		while (result < value_)
+			result <<= 1;
+		return result;
+	}
+
+	// Single queue cell: sequence counter plus inline (lazily constructed) value storage.
+	struct Cell
+	{
+		std::atomic<SizeType>									sequence;
+		std::aligned_storage_t<sizeof(ValueType), alignof(ValueType)>	storage;
+	};
+
+	// Hardware destructive interference size - keeps the hot atomics on separate cache lines.
+	constexpr static SizeType CacheLineSize = 64;
+
+	SizeType const							m_mask;			// capacity - 1 (capacity is a power of two)
+	std::unique_ptr<Cell[]>					m_cells;		// cell ring buffer
+	alignas(CacheLineSize) std::atomic<SizeType>	m_enqueuePos;	// producers' cursor
+	alignas(CacheLineSize) std::atomic<SizeType>	m_dequeuePos;	// consumer's cursor
+};
+
+} // namespace edge
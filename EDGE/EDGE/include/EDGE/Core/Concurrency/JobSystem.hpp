@@ -0,0 +1,194 @@
+// File description:
+// Implements the engine job system - a work-stealing thread pool with job dependencies and parallelFor.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/NonCopyable.hpp>
+
+namespace edge
+{
+
+namespace detail
+{
+struct Job;
+struct JobWorkerQueue;
+}
+
+/// <summary>
+/// Work-stealing thread pool with job dependencies.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Each worker owns a deque: it pops its own jobs from the front and steals
+///		from the back of other workers when idle. Jobs may depend on other jobs -
+///		a job is queued only once every dependency has finished, which is enough
+///		to express task graphs. <see cref="wait"/> helps executing jobs instead of
+///		blocking, so it is safe to wait from inside a job.
+/// </para>
+/// </remarks>
+class JobSystem
+	: INonCopyable
+{
+public:
+	// Type of the work performed by a job.
+	using JobFn = std::function<void()>;
+
+	/// <summary>
+	/// Lightweight shared handle to a scheduled job (usable as a dependency or wait target).
+	/// </summary>
+	class JobHandle
+	{
+		friend class JobSystem;
+	public:
+		JobHandle() = default;
+
+		/// <summary>
+		/// Determines whether the handle refers to a job.
+		/// </summary>
+		/// <returns><c>true</c> if obtained from schedule(); otherwise, <c>false</c>.</returns>
+		bool isValid() const {
+			return m_job != nullptr;
+		}
+	private:
+		explicit JobHandle(std::shared_ptr<detail::Job> job_)
+			: m_job{ std::move(job_) }
+		{
+		}
+
+		std::shared_ptr<detail::Job> m_job;
+	};
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="JobSystem"/> class and starts the workers.
+	/// </summary>
+	/// <param name="workerCount_">Number of worker threads; 0 picks hardware concurrency minus one (at least 1).</param>
+	explicit JobSystem(std::size_t workerCount_ = 0);
+
+	/// <summary>
+	/// Finalizes an instance of the <see cref="JobSystem"/> class. Finishes every queued job first.
+	/// </summary>
+	~JobSystem();
+
+	/// <summary>
+	/// Schedules a job for execution on any worker.
+	/// </summary>
+	/// <param name="job_">The work to perform.</param>
+	/// <returns>Handle to the scheduled job.</returns>
+	JobHandle schedule(JobFn job_);
+
+	/// <summary>
+	/// Schedules a job that runs only after every listed dependency has finished.
+	/// </summary>
+	/// <param name="job_">The work to perform.</param>
+	/// <param name="dependencies_">Jobs that must finish first.</param>
+	/// <returns>Handle to the scheduled job.</returns>
+	JobHandle schedule(JobFn job_, std::initializer_list<JobHandle> dependencies_);
+
+	/// <summary>
+	/// Blocks until the job has finished, executing other jobs meanwhile.
+	/// </summary>
+	/// <param name="handle_">The job to wait for.</param>
+	void wait(JobHandle const & handle_);
+
+	/// <summary>
+	/// Determines whether the job has finished.
+	/// </summary>
+	/// <param name="handle_">The job.</param>
+	/// <returns><c>true</c> if finished (or the handle is empty); otherwise, <c>false</c>.</returns>
+	bool isFinished(JobHandle const & handle_) const;
+
+	/// <summary>
+	/// Runs `func_(index)` for every index in [begin_, end_), split into chunks across the workers.
+	/// </summary>
+	/// <param name="begin_">First index.</param>
+	/// <param name="end_">One past the last index.</param>
+	/// <param name="func_">Callable invoked per index.</param>
+	/// <param name="chunkSize_">Indices per job; 0 picks a chunk count of roughly 4 jobs per worker.</param>
+	/// <remarks>
+	/// <para>Blocks until the whole range was processed (the calling thread helps).</para>
+	/// </remarks>
+	template <typename _func>
+	void parallelFor(std::size_t const begin_, std::size_t const end_, _func func_, std::size_t chunkSize_ = 0)
+	{
+		if (begin_ >= end_)
+			return;
+
+		auto const total = end_ - begin_;
+		if (chunkSize_ == 0)
+			chunkSize_ = std::max<std::size_t>(1, total / (this->workerCount() * 4));
+
+		std::vector<JobHandle> chunks;
+		chunks.reserve((total + chunkSize_ - 1) / chunkSize_);
+		for (std::size_t chunkBegin = begin_; chunkBegin < end_; chunkBegin += chunkSize_)
+		{
+			auto const chunkEnd = std::min(chunkBegin + chunkSize_, end_);
+			chunks.push_back(this->schedule(
+				[func_, chunkBegin, chunkEnd] {
+					for (std::size_t i = chunkBegin; i < chunkEnd; i++)
+						func_(i);
+				}));
+		}
+		for (auto const & chunk : chunks)
+			this->wait(chunk);
+	}
+
+	/// <summary>
+	/// Returns the number of worker threads.
+	/// </summary>
+	/// <returns>Number of worker threads.</returns>
+	std::size_t workerCount() const {
+		return m_queues.size();
+	}
+
+	/// <summary>
+	/// Returns the engine-wide job system (created on first use).
+	/// </summary>
+	/// <returns>Reference to the global instance.</returns>
+	static JobSystem& global();
+
+private:
+
+	/// <summary>
+	/// Pushes a ready job onto one of the worker queues and wakes a worker.
+	/// </summary>
+	/// <param name="job_">The job (all dependencies satisfied).</param>
+	void enqueue(std::shared_ptr<detail::Job> job_);
+
+	/// <summary>
+	/// Marks the job finished and releases its dependents.
+	/// </summary>
+	/// <param name="job_">The finished job.</param>
+	void finish(detail::Job & job_);
+
+	/// <summary>
+	/// Pops a job from the own queue (front) or steals one (back of another queue).
+	/// </summary>
+	/// <param name="preferredQueue_">Queue index to try first (the worker's own).</param>
+	/// <returns>A job, or null when every queue is empty.</returns>
+	std::shared_ptr<detail::Job> takeJob(std::size_t const preferredQueue_);
+
+	/// <summary>
+	/// Executes one available job, if any.
+	/// </summary>
+	/// <returns><c>true</c> if a job was executed; otherwise, <c>false</c>.</returns>
+	bool tryExecuteOne();
+
+	/// <summary>
+	/// Worker thread main loop.
+	/// </summary>
+	/// <param name="workerIndex_">Index of this worker (and of its own queue).</param>
+	void workerLoop(std::size_t const workerIndex_);
+
+	std::vector< std::unique_ptr<detail::JobWorkerQueue> >	m_queues;		// one deque per worker
+	std::vector<std::thread>								m_workers;		// worker threads
+	std::atomic<std::size_t>								m_nextQueue;	// round-robin cursor for external submissions
+	std::atomic<bool>										m_running;		// cleared on destruction
+	std::mutex												m_sleepMutex;	// guards worker sleep
+	std::condition_variable									m_sleepCv;		// wakes sleeping workers
+};
+
+} // namespace edge
@@ -0,0 +1,240 @@
+// File description:
+// Implements a chainable asynchronous task type on top of the job system.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/Concurrency/JobSystem.hpp>
+
+namespace edge
+{
+
+/// <summary>
+/// Handle to a value being computed on the <see cref="JobSystem"/>, with continuation chaining.
+/// </summary>
+/// <remarks>
+/// <para>
+///		<c>Task&lt;T&gt;::run(jobs, work)</c> schedules the work on a worker and
+///		returns immediately; <c>then()</c> chains a continuation that receives the
+///		result and runs as a dependent job, so multi-stage pipelines (read -&gt;
+///		decompress -&gt; decode) are expressed as a chain instead of hand-managed
+///		dependency lists. <c>get()</c> blocks by helping execute jobs (the job
+///		system's wait), so waiting from inside another job cannot deadlock.
+/// </para>
+/// <para>
+///		The toolset pins us to C++17, where coroutines are still the Coroutines TS -
+///		continuation chaining covers the same streaming use cases without tying the
+///		codebase to <c>/await</c> and <c>std::experimental</c>. Tasks are cheap
+///		shared handles (copying shares the same result). Work must not throw - the
+///		engine reports failures by value (e.g. std::optional), not exceptions.
+/// </para>
+/// </remarks>
+template <typename T>
+class Task
+{
+	template <typename>
+	friend class Task;
+
+public:
+
+	/// <summary>
+	/// Initializes an empty handle (isValid() == false).
+	/// </summary>
+	Task() = default;
+
+	/// <summary>
+	/// Schedules the work on the job system and returns a handle to its future result.
+	/// </summary>
+	/// <param name="jobs_">The job system to run on (must outlive the task).</param>
+	/// <param name="work_">Callable producing the value.</param>
+	/// <returns>Handle to the running task.</returns>
+	static Task run(JobSystem & jobs_, std::function<T()> work_)
+	{
+		Task task;
+		task.m_state = std::make_shared<State>();
+		task.m_state->system = &jobs_;
+		task.m_state->handle = jobs_.schedule(
+			[state = task.m_state, work = std::move(work_)] {
+				state->value.emplace(work());
+			});
+		return task;
+	}
+
+	/// <summary>
+	/// Chains a continuation receiving this task's result; it runs once the result is ready.
+	/// </summary>
+	/// <param name="continuation_">Callable invoked with a reference to the result.</param>
+	/// <returns>Task of the continuation's own result.</returns>
+	template <typename FuncType>
+	auto then(FuncType continuation_) const -> Task<std::invoke_result_t<FuncType, T&>>
+	{
+		using ResultType = std::invoke_result_t<FuncType, T&>;
+
+		// # Assertion note:
+		// Chaining from a default-constructed handle has nothing to run after.
+		assert(this->isValid());
+
+		Task<ResultType> task;
+		task.m_state = std::make_shared<typename Task<ResultType>::State>();
+		task.m_state->system = m_state->system;
+		task.m_state->handle = m_state->system->schedule(
+			[previous = m_state, state = task.m_state, continuation = std::move(continuation_)]() mutable {
+				if constexpr (std::is_void_v<ResultType>)
+					continuation(*previous->value);
+				else
+					state->value.emplace(continuation(*previous->value));
+			},
+			{ m_state->handle });
+		return task;
+	}
+
+	/// <summary>
+	/// Determines whether the handle refers to scheduled work.
+	/// </summary>
+	/// <returns><c>true</c> if obtained from run() or then(); otherwise, <c>false</c>.</returns>
+	bool isValid() const {
+		return m_state != nullptr;
+	}
+
+	/// <summary>
+	/// Determines whether the result is already available.
+	/// </summary>
+	/// <returns><c>true</c> if get() would not block; otherwise, <c>false</c>.</returns>
+	bool isReady() const {
+		return m_state != nullptr && m_state->system->isFinished(m_state->handle);
+	}
+
+	/// <summary>
+	/// Waits for the result, helping execute jobs meanwhile, and returns it.
+	/// </summary>
+	/// <returns>Reference to the computed value (lives as long as the last handle).</returns>
+	T& get()
+	{
+		// # Assertion note:
+		// There is no value to wait for behind an empty handle.
+		assert(this->isValid());
+
+		m_state->system->wait(m_state->handle);
+		return *m_state->value;
+	}
+
+private:
+
+	/// <summary>
+	/// Result storage shared between handles and the worker-side job.
+	/// </summary>
+	struct State
+	{
+		JobSystem*				system = nullptr;
+		JobSystem::JobHandle	handle;
+		std::optional<T>		value;
+	};
+
+	std::shared_ptr<State> m_state;
+};
+
+/// <summary>
+/// Task of no value - a completion handle with continuation chaining.
+/// </summary>
+template <>
+class Task<void>
+{
+	template <typename>
+	friend class Task;
+
+public:
+
+	/// <summary>
+	/// Initializes an empty handle (isValid() == false).
+	/// </summary>
+	Task() = default;
+
+	/// <summary>
+	/// Schedules the work on the job system and returns a handle to its completion.
+	/// </summary>
+	/// <param name="jobs_">The job system to run on (must outlive the task).</param>
+	/// <param name="work_">Callable to run.</param>
+	/// <returns>Handle to the running task.</returns>
+	static Task run(JobSystem & jobs_, std::function<void()> work_)
+	{
+		Task task;
+		task.m_state = std::make_shared<State>();
+		task.m_state->system = &jobs_;
+		task.m_state->handle = jobs_.schedule(std::move(work_));
+		return task;
+	}
+
+	/// <summary>
+	/// Chains a continuation that runs once this task has completed.
+	/// </summary>
+	/// <param name="continuation_">Callable invoked after completion.</param>
+	/// <returns>Task of the continuation's own result.</returns>
+	template <typename FuncType>
+	auto then(FuncType continuation_) const -> Task<std::invoke_result_t<FuncType>>
+	{
+		using ResultType = std::invoke_result_t<FuncType>;
+
+		// # Assertion note:
+		// Chaining from a default-constructed handle has nothing to run after.
+		assert(this->isValid());
+
+		Task<ResultType> task;
+		task.m_state = std::make_shared<typename Task<ResultType>::State>();
+		task.m_state->system = m_state->system;
+		task.m_state->handle = m_state->system->schedule(
+			[state = task.m_state, continuation = std::move(continuation_)]() mutable {
+				if constexpr (std::is_void_v<ResultType>)
+					continuation();
+				else
+					state->value.emplace(continuation());
+			},
+			{ m_state->handle });
+		return task;
+	}
+
+	/// <summary>
+	/// Determines whether the handle refers to scheduled work.
+	/// </summary>
+	/// <returns><c>true</c> if obtained from run() or then(); otherwise, <c>false</c>.</returns>
+	bool isValid() const {
+		return m_state != nullptr;
+	}
+
+	/// <summary>
+	/// Determines whether the task has completed.
+	/// </summary>
+	/// <returns><c>true</c> if wait() would not block; otherwise, <c>false</c>.</returns>
+	bool isReady() const {
+		return m_state != nullptr && m_state->system->isFinished(m_state->handle);
+	}
+
+	/// <summary>
+	/// Waits for completion, helping execute jobs meanwhile.
+	/// </summary>
+	void wait()
+	{
+		// # Assertion note:
+		// There is no work to wait for behind an empty handle.
+		assert(this->isValid());
+
+		m_state->system->wait(m_state->handle);
+	}
+
+private:
+
+	/// <summary>
+	/// Completion state shared between handles and the worker-side job.
+	/// </summary>
+	struct State
+	{
+		JobSystem*				system = nullptr;
+		JobSystem::JobHandle	handle;
+	};
+
+	std::shared_ptr<State> m_state;
+};
+
+} // namespace edge
@@ -1,11 +1,20 @@
+// File description:
+// Implements event dispatching classes (EventHook, EventReceiver, EventDispatcher).
+
 #pragma once
 
-#include "../../../stdafx.h"
+// Precompiled header:
+#include EDGE_PCH
 
 #include <typeinfo>
 #include <typeindex>
 
-namespace agdk
+// Custom includes:
+#include <EDGE/Core/Concurrency/ConcurrentQueue.hpp>
+#include <EDGE/Core/Memory/PoolAllocator.hpp>
+#include <EDGE/Core/Profiler.hpp>
+
+namespace edge
 {
 
 class EventReceiver;
@@ -13,9 +22,42 @@ class EventDispatcherInterface;
 template <typename... _Args>
 class EventDispatcher;
 
+/// <summary>
+/// Lightweight token identifying a single subscription inside an EventDispatcher.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Returned by <see cref="EventDispatcher::subscribe"/>; pass it back to
+///		<see cref="EventDispatcher::unsubscribe"/> for O(1) removal. The generation
+///		counter makes stale handles (already unsubscribed slots) safely ignored.
+/// </para>
+/// </remarks>
+struct EventHookHandle
+{
+	constexpr static std::uint32_t InvalidSlot = std::numeric_limits<std::uint32_t>::max();
+
+	std::uint32_t slot			= InvalidSlot;
+	std::uint32_t generation	= 0;
+
+	/// <summary>
+	/// Determines whether the handle refers to any slot at all.
+	/// </summary>
+	/// <returns><c>true</c> if the handle was obtained from subscribe(); otherwise, <c>false</c>.</returns>
+	constexpr bool isValid() const {
+		return slot != InvalidSlot;
+	}
+};
+
 /// <summary>
 /// Class representing hooked object method.
 /// </summary>
+/// <remarks>
+/// <para>
+///		Hooks are plain values: the pointer-to-member wrapper lives in an inline
+///		small buffer, so dispatchers can store hooks contiguously and `emit()`
+///		walks a flat array without chasing per-hook heap pointers.
+/// </para>
+/// </remarks>
 template <typename... _Args>
 class EventHook
 {
@@ -34,11 +76,18 @@ class EventHook
 		}
 		Type fn;
 	};
-	
+
+	// Inline storage for FunctionWrapper of any receiver class.
+	// Pointers-to-member of classes with unknown inheritance are the largest (4 machine words on MSVC).
+	constexpr static std::size_t StorageSize	= 4 * sizeof(void*);
+	constexpr static std::size_t StorageAlign	= alignof(std::max_align_t);
+
 	// Type of an invoker function.
 	using InvokerFn = void(*)(EventHook&, _Args const&...);
+	// Type of a forwarding invoker function (takes arguments by value so rvalues are moved through).
+	using ForwardInvokerFn = void(*)(EventHook&, _Args...);
 	// Type of a comparing function.
-	using CompareFn = bool(*)(void*, void*);
+	using CompareFn = bool(*)(void const*, void const*);
 public:
 
 	/// <summary>
@@ -47,68 +96,54 @@ public:
 	/// <param name="receiver_">The receiver object.</param>
 	/// <param name="method_">The receiver method.</param>
 	template <typename _Class,
-		typename = std::enable_if_t< std::is_base_of_v<EventReceiver, _Class> > >		// allow only derivatives of EventReceiver		
+		typename = std::enable_if_t< std::is_base_of_v<EventReceiver, _Class> > >		// allow only derivatives of EventReceiver
 	EventHook(_Class &receiver_, void (_Class::*method_)(_Args...))
 		:
 		m_receiver{ &receiver_ },														// store pointer to receiver
-		m_fnWrapper{																	// store wrapper to method
-		new FunctionWrapper<_Class>(method_),
-			[](void *deletedObject) {													// type-erasure forces to use custom deleter
-				delete (static_cast< FunctionWrapper<_Class>* >(deletedObject));
-			}
-		},
 		m_recvType{ typeid(_Class) },													// store receiver typeid code (used when comparing EventHooks)
 		m_invoker{ invoker<_Class> },													// store pointer to invoker function (we cannot directly call object's method because of type erasure)
+		m_forwardInvoker{ forwardInvoker<_Class> },										// store pointer to forwarding (move-aware) invoker function
 		m_compare{ compare<_Class> }													// store pointer to comparing function
 	{
+		// The wrapper is relocated byte-wise when the hook moves inside a vector,
+		// so it must fit the small buffer and be trivially copyable/destructible.
+		static_assert(sizeof(FunctionWrapper<_Class>) <= StorageSize,					"FunctionWrapper does not fit the inline hook storage.");
+		static_assert(alignof(FunctionWrapper<_Class>) <= StorageAlign,					"FunctionWrapper is over-aligned for the inline hook storage.");
+		static_assert(std::is_trivially_copyable_v< FunctionWrapper<_Class> >,			"FunctionWrapper must be trivially copyable.");
+		static_assert(std::is_trivially_destructible_v< FunctionWrapper<_Class> >,		"FunctionWrapper must be trivially destructible.");
+
+		new (static_cast<void*>(&m_fnStorage)) FunctionWrapper<_Class>(method_);		// store wrapper to method (inside inline storage)
 	}
-			
+
 	/// <summary>
 	/// Copy constructing a <see cref="EventHook"/> object is forbidden.
 	/// </summary>
 	/// <param name="other_">The other event hook.</param>
 	EventHook(EventHook const &other_) = delete;
-	
+
 	/// <summary>
 	/// Copy assigning a <see cref="EventHook"/> object is forbidden.
 	/// </summary>
 	/// <param name="other_">The other event hook.</param>
 	/// <returns>Reference to self; but deleted.</returns>
 	EventHook& operator=(EventHook const &other_) = delete;
-	
+
 	/// <summary>
 	/// Initializes a new instance of the <see cref="EventHook"/> class from moved hook.
 	/// </summary>
 	/// <param name="moved_">The moved hook.</param>
-	EventHook(EventHook &&moved_)
-		:
-		m_receiver{ moved_.m_receiver },
-		m_fnWrapper{ std::move(moved_.m_fnWrapper) },
-		m_recvType{ moved_.m_recvType },
-		m_invoker{ moved_.m_invoker },
-		m_compare{ moved_.m_compare }
-	{
-		moved_.m_receiver = nullptr;
-		moved_.m_fnWrapper = nullptr;
-		moved_.m_invoker = nullptr;
-		moved_.m_compare = nullptr;
-	}
-	
+	/// <remarks>
+	/// <para>Trivial (byte-wise) - lets std::vector relocate hooks with a plain memmove.</para>
+	/// </remarks>
+	EventHook(EventHook &&moved_) = default;
+
 	/// <summary>
 	/// Performs move assignment.
 	/// </summary>
 	/// <param name="moved_">The moved.</param>
 	/// <returns>Reference to self.</returns>
-	EventHook& operator=(EventHook &&moved_)
-	{
-		m_receiver = moved_.m_receiver;
-		m_fnWrapper = moved_.m_fnWrapper;	// original automatically deleted, no need for move-swap idiom.
-		m_recvType = moved_.m_recvType;
-		m_invoker = moved_.m_invoker;
-		m_compare = moved_.m_compare;
-		return *this;
-	}
-	
+	EventHook& operator=(EventHook &&moved_) = default;
+
 	/// <summary>
 	/// Compares two event hooks - equal only when methods they point to have the same address.
 	/// </summary>
@@ -121,9 +156,9 @@ public:
 			return false;
 
 		// If two tyles match up compare them using special compare function.
-		return m_compare(m_fnWrapper.get(), other_.m_fnWrapper.get());
+		return m_compare(&m_fnStorage, &other_.m_fnStorage);
 	}
-	
+
 	/// <summary>
 	/// Returns the receiver object.
 	/// </summary>
@@ -135,7 +170,7 @@ public:
 	/// Dispatcher calls `invoke` method that is private.
 	friend class EventDispatcher<_Args...>;
 private:
-	
+
 	/// <summary>
 	/// Invokes the method with specified args.
 	/// </summary>
@@ -145,25 +180,55 @@ private:
 		m_invoker(*this, args_...);
 	}
 
+	/// <summary>
+	/// Invokes the method, moving the arguments through to it (used for the last hook of an emit).
+	/// </summary>
+	/// <param name="args_">The method parameters (taken by value; rvalues are moved in).</param>
+	void invokeForward(_Args... args_)
+	{
+		// std::forward keeps reference parameters as lvalues and moves value parameters.
+		m_forwardInvoker(*this, std::forward<_Args>(args_)...);
+	}
+
 	/// <summary>
 	/// Invokes the specified hook.
 	/// </summary>
 	/// <param name="hook_">The hook.</param>
 	/// <param name="args_">The method parameters.</param>
-	/// <remarks>
-	/// <para>Perfect forwarding here is probably impossible (needs verification)</para>
-	/// </remarks>
 	template <typename _Class>
 	static void invoker(EventHook& hook_, _Args const&... args_)
 	{
 		// Recover types back from type-erasure.
-		auto fnWrapper		= static_cast< FunctionWrapper<_Class>* >(hook_.m_fnWrapper.get());
+		auto fnWrapper		= reinterpret_cast< FunctionWrapper<_Class> const* >(&hook_.m_fnStorage);
 		auto recvObject		= static_cast<_Class*>(hook_.m_receiver);
 		auto fn				= fnWrapper->fn;
 		// Call the proper method.
 		(recvObject->*fn)(args_...);
 	}
 
+	/// <summary>
+	/// Invokes the specified hook, moving the arguments into the method.
+	/// </summary>
+	/// <param name="hook_">The hook.</param>
+	/// <param name="args_">The method parameters (moved into the call).</param>
+	/// <remarks>
+	/// <para>
+	///		The function pointer must have a fixed signature, so arguments travel by
+	///		value and are moved at every step - an rvalue passed to emit() reaches
+	///		the method without a single deep copy.
+	/// </para>
+	/// </remarks>
+	template <typename _Class>
+	static void forwardInvoker(EventHook& hook_, _Args... args_)
+	{
+		// Recover types back from type-erasure.
+		auto fnWrapper		= reinterpret_cast< FunctionWrapper<_Class> const* >(&hook_.m_fnStorage);
+		auto recvObject		= static_cast<_Class*>(hook_.m_receiver);
+		auto fn				= fnWrapper->fn;
+		// Call the proper method (std::forward keeps reference parameters as lvalues).
+		(recvObject->*fn)(std::forward<_Args>(args_)...);
+	}
+
 	/// <summary>
 	/// Compares the specified function wrappers.
 	/// </summary>
@@ -173,18 +238,19 @@ private:
 	///		<c>true</c> if wrappers refer to the same method; otherwise <c>false</c>.
 	/// </returns>
 	template <typename _Class>
-	static bool compare(void* leftFnWrapper_, void* rightFnWrapper_)
+	static bool compare(void const* leftFnWrapper_, void const* rightFnWrapper_)
 	{
-		// At this point we can safely cast void* to FunctionWrapper<_Class>*, because std::type_index is stored.
-		return 	static_cast< FunctionWrapper<_Class>* >(leftFnWrapper_)->fn ==
-				static_cast< FunctionWrapper<_Class>* >(rightFnWrapper_)->fn;
+		// At this point we can safely cast void const* to FunctionWrapper<_Class> const*, because std::type_index is stored.
+		return 	static_cast< FunctionWrapper<_Class> const* >(leftFnWrapper_)->fn ==
+				static_cast< FunctionWrapper<_Class> const* >(rightFnWrapper_)->fn;
 	}
 
-	EventReceiver* 							m_receiver;		// pointer to receiver object
-	std::unique_ptr<void, void(*)(void*)> 	m_fnWrapper;	// pointer to wrapper of the method
-	std::type_index 						m_recvType;		// receiver type_index used when comparing
-	InvokerFn 								m_invoker;		// invoker function
-	CompareFn								m_compare;		// compare function
+	EventReceiver* 									m_receiver;		// pointer to receiver object
+	std::aligned_storage_t<StorageSize, StorageAlign>	m_fnStorage;	// inline storage of the method wrapper
+	std::type_index 								m_recvType;		// receiver type_index used when comparing
+	InvokerFn 										m_invoker;		// invoker function
+	ForwardInvokerFn								m_forwardInvoker;	// forwarding (move-aware) invoker function
+	CompareFn										m_compare;		// compare function
 };
 
 /// <summary>
@@ -197,19 +263,19 @@ public:
 	// Event receiver needs to access `removeReceiver` method.
 	friend class EventReceiver;
 protected:
-	
+
 	/// <summary>
 	/// Adds the method hook
 	/// </summary>
 	/// <param name="hook_">The hook.</param>
-	virtual void addHook(void* hook_) = 0;	
+	virtual void addHook(void* hook_) = 0;
 
 	/// <summary>
 	/// Removes the receiver and all of its hooks.
 	/// </summary>
 	/// <param name="recv_">The receiver.</param>
 	virtual void removeReceiver(EventReceiver& recv_) = 0;
-	
+
 	/// <summary>
 	/// Removes the method hook.
 	/// </summary>
@@ -222,45 +288,67 @@ protected:
 /// </summary>
 class EventReceiver
 {
-public:	
+public:
 	/// <summary>
 	/// Finalizes an instance of the <see cref="EventReceiver"/> class.
 	/// </summary>
 	virtual ~EventReceiver()
 	{
-		for (auto &disp : m_dispatchers)
-			disp->removeReceiver(*this);
+		// removeReceiver drops every hook of this receiver, which zeroes the link's
+		// refcount and erases it - so we just drain the list from the back.
+		while (!m_dispatchers.empty())
+			m_dispatchers.back().dispatcher->removeReceiver(*this);
 	}
 
 	// Event dispatcher needs to access `addDispatcher` and `removeDispatcher` methods.
 	template <typename... _Args>
 	friend class EventDispatcher;
 private:
-	
+
+	// Link to a dispatcher, counting how many hooks of this receiver it holds.
+	struct DispatcherLink
+	{
+		EventDispatcherInterface*	dispatcher;
+		std::uint32_t				hookCount;
+	};
+
 	/// <summary>
-	/// Adds the dispatcher.
+	/// Adds the dispatcher (or bumps the hook refcount of an existing link).
 	/// </summary>
 	/// <param name="disp_">The dispatcher.</param>
 	void addDispatcher(EventDispatcherInterface &disp_)
 	{
-		auto it = std::find(m_dispatchers.begin(), m_dispatchers.end(), &disp_);
-		if (it == m_dispatchers.end()) // protect from multiple records
-			m_dispatchers.push_back(&disp_);
+		auto it = std::find_if(m_dispatchers.begin(), m_dispatchers.end(),
+			[&disp_](DispatcherLink const & link_) {
+				return link_.dispatcher == &disp_;
+			});
+		if (it != m_dispatchers.end())
+			it->hookCount++;
+		else
+			m_dispatchers.push_back(DispatcherLink{ &disp_, 1 });
 	}
-	
+
 	/// <summary>
-	/// Removes the dispatcher.
+	/// Drops one hook refcount of the dispatcher link; erases the link when it hits zero.
 	/// </summary>
 	/// <param name="disp_">The dispatcher.</param>
 	void removeDispatcher(EventDispatcherInterface &disp_)
 	{
-		auto it = std::find(m_dispatchers.begin(), m_dispatchers.end(), &disp_);
-		if (it != m_dispatchers.end())
-			m_dispatchers.erase(it);
+		auto it = std::find_if(m_dispatchers.begin(), m_dispatchers.end(),
+			[&disp_](DispatcherLink const & link_) {
+				return link_.dispatcher == &disp_;
+			});
+		if (it != m_dispatchers.end() && --(it->hookCount) == 0)
+		{
+			// Order does not matter - swap-and-pop instead of shifting the tail.
+			*it = m_dispatchers.back();
+			m_dispatchers.pop_back();
+		}
 	}
 
-	// Stores every dispatcher, so when objects get destroyed it can notify them.
-	std::vector<EventDispatcherInterface*> m_dispatchers;
+	// Stores every dispatcher (with hook refcount), so when objects get destroyed it can notify them.
+	// Pool-backed: spawning bursts of receivers reuses freed blocks instead of hitting the heap.
+	std::vector<DispatcherLink, PoolAllocator<DispatcherLink>> m_dispatchers;
 };
 
 
@@ -290,53 +378,171 @@ template <typename... _Args>
 class EventDispatcher
 	: public EventDispatcherInterface
 {
-public:	
+public:
+	// Deferred events are stored as tuples of decayed arguments.
+	using PendingArgs = std::tuple< std::decay_t<_Args>... >;
+
 	/// <summary>
 	/// Initializes a new instance of the <see cref="EventDispatcher"/> class.
 	/// </summary>
 	EventDispatcher() { }
-	
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="EventDispatcher"/> class with deferred mode enabled.
+	/// </summary>
+	/// <param name="pendingCapacity_">Capacity of the pending event queue (rounded up to a power of two).</param>
+	explicit EventDispatcher(std::size_t const pendingCapacity_)
+		: m_pending{ std::make_unique< BoundedConcurrentQueue<PendingArgs> >(pendingCapacity_) }
+	{
+	}
+
 	/// <summary>
 	/// Finalizes an instance of the <see cref="EventDispatcher"/> class.
 	/// </summary>
 	~EventDispatcher() {
 		this->clear();
 	}
-		
+
 	/// <summary>
 	/// Copy constructing a <see cref="EventDispatcher"/> object is forbidden.
 	/// </summary>
 	/// <param name="other_">The other dispatcher.</param>
 	EventDispatcher(EventDispatcher const & other_) = delete;
-	
+
 	/// <summary>
 	/// Copy assigning a <see cref="EventDispatcher"/> object is forbidden.
 	/// </summary>
 	/// <param name="other_">The other dispatcher.</param>
 	/// <returns>Reference to self; but deleted.</returns>
 	EventDispatcher& operator=(EventDispatcher const & other_) = delete;
-	
+
 	/// <summary>
 	/// Emits the event with specified arguments.
 	/// </summary>
 	/// <param name="args_">The arguments.</param>
-	void emit(_Args const&... args_)
+	/// <remarks>
+	/// <para>
+	///		Rvalue arguments are forwarded: every hook but the last observes them by
+	///		reference, and the last hook receives them moved - emitting heavy payloads
+	///		(strings, snapshot vectors) no longer deep-copies per hook.
+	/// </para>
+	/// </remarks>
+	template <typename... _EmitArgs>
+	void emit(_EmitArgs&&... args_)
+	{
+		static_assert(sizeof...(_EmitArgs) == sizeof...(_Args), "emit() requires exactly one argument per event parameter.");
+
+		EDGE_PROFILE_SCOPE("EventDispatcher::emit");
+
+		auto const count = m_hooks.size();
+		if (count == 0)
+			return;
+
+		// Hooks live contiguously - this is a linear walk over a flat array.
+		// All but the last hook must not consume the arguments.
+		for (std::size_t i = 0; i + 1 < count; i++)
+			m_hooks[i].invoke(args_...);
+		m_hooks[count - 1].invokeForward(std::forward<_EmitArgs>(args_)...);
+	}
+
+	/// <summary>
+	/// Enqueues the event for a later dispatchPending() call. Safe to call from any thread; never blocks.
+	/// </summary>
+	/// <param name="args_">The arguments (copied/moved into the queue).</param>
+	/// <returns><c>true</c> if the event was enqueued; <c>false</c> if the pending queue is full.</returns>
+	/// <remarks>
+	/// <para>
+	///		Requires deferred mode - construct the dispatcher with a pending queue capacity.
+	///		Reference parameters are stored by value (decayed), since the referees may be
+	///		long gone by the time the consumer thread dispatches.
+	/// </para>
+	/// </remarks>
+	bool emitDeferred(std::decay_t<_Args>... args_)
+	{
+		// # Assertion note:
+		// Deferred mode is opt-in: construct the dispatcher with `EventDispatcher{ pendingCapacity }`.
+		assert(m_pending != nullptr);
+		return m_pending->tryEnqueue(PendingArgs{ std::move(args_)... });
+	}
+
+	/// <summary>
+	/// Dispatches every pending (deferred) event. Call from the consumer (e.g. main) thread.
+	/// </summary>
+	/// <returns>Number of dispatched events.</returns>
+	std::size_t dispatchPending()
+	{
+		if (m_pending == nullptr)
+			return 0;
+
+		std::size_t count = 0;
+		PendingArgs args;
+		while (m_pending->tryDequeue(args))
+		{
+			// The tuple is dead after the call - move its contents into emit()
+			// (except for reference parameters, which hooks expect as lvalues).
+			std::apply(
+				[this](auto &... unpacked_) {
+					this->emit(movePendingArg<_Args>(unpacked_)...);
+				}, args);
+			count++;
+		}
+		return count;
+	}
+
+	/// <summary>
+	/// Adds specified hook and returns a handle for O(1) removal.
+	/// </summary>
+	/// <param name="hook_">The hook.</param>
+	/// <returns>Handle identifying the subscription (see <see cref="unsubscribe"/>).</returns>
+	EventHookHandle subscribe(EventHook<_Args...> hook_)
+	{
+		// Add dispatcher reference to receiver (refcounted).
+		hook_.getReceiver()->addDispatcher(*this);
+
+		// Push hook (by value - hooks are stored contiguously).
+		auto const dense = static_cast<std::uint32_t>(m_hooks.size());
+		m_hooks.push_back(std::move(hook_));
+
+		// Bind a slot to the new dense index (reuse a freed slot when possible).
+		std::uint32_t slot;
+		if (!m_freeSlots.empty())
+		{
+			slot = m_freeSlots.back();
+			m_freeSlots.pop_back();
+			m_slots[slot].dense = dense;
+		}
+		else
+		{
+			slot = static_cast<std::uint32_t>(m_slots.size());
+			m_slots.push_back(Slot{ dense, 0 });
+		}
+		m_hookSlots.push_back(slot);
+		return EventHookHandle{ slot, m_slots[slot].generation };
+	}
+
+	/// <summary>
+	/// Removes the subscription identified by the handle in O(1) (swap-and-pop).
+	/// </summary>
+	/// <param name="handle_">The handle returned by subscribe().</param>
+	/// <remarks>
+	/// <para>Stale or invalid handles are silently ignored.</para>
+	/// </remarks>
+	void unsubscribe(EventHookHandle const handle_)
 	{
-		for (auto &hook : m_hooks)
-			hook->invoke(args_...);
+		if (handle_.slot >= m_slots.size() || m_slots[handle_.slot].generation != handle_.generation)
+			return;
+		this->removeAt(m_slots[handle_.slot].dense);
 	}
-	
+
 	/// <summary>
 	/// Adds specified hook.
 	/// </summary>
 	/// <param name="hook_">The hook.</param>
 	void operator+=(EventHook<_Args...> hook_)
 	{
-		// This is safe, since `hook_` life extends beyond usage of void* ptr.
-		this->addHook(static_cast<void*>(&hook_));
-		// `hook_` was moved!
+		this->subscribe(std::move(hook_));
 	}
-	
+
 	/// <summary>
 	/// Removes the specified hook.
 	/// </summary>
@@ -346,7 +552,7 @@ public:
 		// This is safe, since `hook_` life extends beyond usage of void* ptr.
 		this->removeHook(static_cast<void*>(&hook_));
 	}
-	
+
 	/// <summary>
 	/// Removes every existing hook.
 	/// </summary>
@@ -354,11 +560,32 @@ public:
 	{
 		// OPTIMIZE TODO: this can get more optimized
 		while (!m_hooks.empty()) {
-			this->removeReceiver(*m_hooks[0]->getReceiver());
+			this->removeReceiver(*m_hooks[0].getReceiver());
 		}
 	}
 private:
-	
+
+	// Slot map entry: maps a stable slot to the current dense index of its hook.
+	struct Slot
+	{
+		std::uint32_t dense;
+		std::uint32_t generation;
+	};
+
+	/// <summary>
+	/// Prepares a stored pending argument for emit(): moved for value parameters, left as lvalue for reference ones.
+	/// </summary>
+	/// <param name="stored_">The stored (decayed) argument.</param>
+	/// <returns>Rvalue reference for value parameters; lvalue reference for reference parameters.</returns>
+	template <typename _Arg, typename _Stored>
+	static decltype(auto) movePendingArg(_Stored& stored_)
+	{
+		if constexpr (std::is_reference_v<_Arg>)
+			return (stored_);
+		else
+			return std::move(stored_);
+	}
+
 	/// <summary>
 	/// Adds method the hook.
 	/// </summary>
@@ -369,27 +596,53 @@ private:
 		// The original type was EventHook<_Args...> and since we cannot copy it, we must take a reference.
 		// See operator += and operator-= : the object (with automatic storage duration) life extends beyond current function, so its safe.
 		auto &deHook = *static_cast< EventHook<_Args...>* >(hook_);
-		// Add dispatcher reference to receiver.
-		deHook.getReceiver()->addDispatcher(*this);
-		// Push hook
-		m_hooks.push_back(std::make_unique< EventHook<_Args...> >(std::move(deHook)));
+		this->subscribe(std::move(deHook));
+	}
+
+	/// <summary>
+	/// Removes the hook at the given dense index in O(1), keeping the slot map consistent.
+	/// </summary>
+	/// <param name="dense_">The dense index inside m_hooks.</param>
+	void removeAt(std::uint32_t const dense_)
+	{
+		auto* recv			= m_hooks[dense_].getReceiver();
+		auto const slot		= m_hookSlots[dense_];
+		auto const last		= static_cast<std::uint32_t>(m_hooks.size() - 1);
+
+		// Swap-and-pop: the last hook takes the freed dense index.
+		if (dense_ != last)
+		{
+			m_hooks[dense_]						= std::move(m_hooks[last]);
+			m_hookSlots[dense_]					= m_hookSlots[last];
+			m_slots[ m_hookSlots[dense_] ].dense	= dense_;
+		}
+		m_hooks.pop_back();
+		m_hookSlots.pop_back();
+
+		// Retire the slot; bumping the generation invalidates outstanding handles.
+		m_slots[slot].generation++;
+		m_freeSlots.push_back(slot);
+
+		// Drop one hook refcount on the receiver link (replaces the old count_if rescan).
+		recv->removeDispatcher(*this);
 	}
-	
+
 	/// <summary>
 	/// Removes the receiver and all of its hooks.
 	/// </summary>
 	/// <param name="recv_">The receiver.</param>
 	virtual void removeReceiver(EventReceiver& recv_) override
 	{
-		m_hooks.erase(
-			std::remove_if(m_hooks.begin(), m_hooks.end(),
-				[&recv_](std::unique_ptr< EventHook<_Args...> > const & element_) {
-			return element_->getReceiver() == &recv_;
-		}),
-			m_hooks.end());
-		recv_.removeDispatcher(*this);
+		for (std::uint32_t i = 0; i < m_hooks.size(); /* incremented below */)
+		{
+			// On removal the swapped-in hook occupies index `i` - re-examine it.
+			if (m_hooks[i].getReceiver() == &recv_)
+				this->removeAt(i);
+			else
+				i++;
+		}
 	}
-	
+
 	/// <summary>
 	/// Removes the method hook.
 	/// </summary>
@@ -401,24 +654,26 @@ private:
 		// See operator += and operator-= : the object (with automatic storage duration) life extends beyond current function, so its safe.
 		auto &deHook = *static_cast<EventHook<_Args...>*>(hook_);
 		auto it = std::find_if(m_hooks.begin(), m_hooks.end(),
-			[&deHook](std::unique_ptr< EventHook<_Args...> > const & element_) {
-			return *element_ == deHook;
+			[&deHook](EventHook<_Args...> const & element_) {
+			return element_ == deHook;
 		});
 		if (it != m_hooks.end())
-			m_hooks.erase(it);
-
-		// At this point reference to a dispatcher inside receiver is still stored.
-		// We need to check if there is any other hook from that receiver; if not - remove ref.
-		std::size_t howManyHooks = std::count_if(m_hooks.begin(), m_hooks.end(),
-			[&deHook](std::unique_ptr< EventHook<_Args...> > const & element_) {
-			return element_->getReceiver() == deHook.getReceiver();
-		});
-		if (howManyHooks == 0)
-			deHook.getReceiver()->removeDispatcher(*this);
+			this->removeAt(static_cast<std::uint32_t>(it - m_hooks.begin()));
 	}
 
-	// Stores every hook.
-	std::vector< std::unique_ptr< EventHook<_Args...> > > m_hooks;
+	// All dispatcher containers are pool-backed - subscription churn reuses
+	// this thread's freed blocks, so steady-state setup is allocation-free.
+
+	// Stores every hook (flat, by value; dense part of the slot map).
+	std::vector< EventHook<_Args...>, PoolAllocator< EventHook<_Args...> > >	m_hooks;
+	// Slot index of every dense hook (parallel to m_hooks).
+	std::vector<std::uint32_t, PoolAllocator<std::uint32_t>>	m_hookSlots;
+	// Sparse slots - stable indices handed out through EventHookHandle.
+	std::vector<Slot, PoolAllocator<Slot>>						m_slots;
+	// Retired slots available for reuse.
+	std::vector<std::uint32_t, PoolAllocator<std::uint32_t>>	m_freeSlots;
+	// Pending (deferred) events; null unless deferred mode was enabled at construction.
+	std::unique_ptr< BoundedConcurrentQueue<PendingArgs> >	m_pending;
 };
 
 }
@@ -0,0 +1,124 @@
+// File description:
+// Implements a fixed-timestep game loop with interpolated rendering and frame pacing.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/NonCopyable.hpp>
+
+namespace edge
+{
+
+/// <summary>
+/// Fixed-timestep game loop with interpolated rendering and frame pacing.
+/// </summary>
+/// <remarks>
+/// <para>
+///		The simulation is advanced in fixed steps (an accumulator carries the
+///		remainder between frames), so update logic sees a constant delta no
+///		matter how the frame rate fluctuates. The render callback receives the
+///		accumulator fraction for interpolating between the last two simulation
+///		states. Between frames the loop sleeps and only spins for the last
+///		moment, so a headless build idles instead of burning a core.
+/// </para>
+/// <para>
+///		Typical usage:
+///		<code>
+///		GameLoop loop;
+///		loop.onFrameBegin	= [&amp;] { /* poll window events, stop() on close */ };
+///		loop.onUpdate		= [&amp;](double dt) { /* advance simulation by dt */ };
+///		loop.onRender		= [&amp;](double alpha) { /* draw, lerp by alpha */ };
+///		loop.run();
+///		</code>
+/// </para>
+/// </remarks>
+class GameLoop
+	: INonCopyable
+{
+public:
+	// Clock the loop is timed with.
+	using Clock		= std::chrono::steady_clock;
+	// Callback advancing the simulation by a fixed delta (seconds).
+	using UpdateFn	= std::function<void(double)>;
+	// Callback rendering a frame; receives the interpolation fraction in [0, 1).
+	using RenderFn	= std::function<void(double)>;
+	// Callback invoked once per frame before updating (input / window events).
+	using FrameFn	= std::function<void()>;
+
+	// Invoked once per frame, first - poll input and window events here.
+	FrameFn		onFrameBegin;
+	// Invoked zero or more times per frame with the fixed delta in seconds.
+	UpdateFn	onUpdate;
+	// Invoked once per frame after updating; skip assigning it on headless builds.
+	RenderFn	onRender;
+
+	/// <summary>
+	/// Sets the fixed simulation rate.
+	/// </summary>
+	/// <param name="updatesPerSecond_">Updates per second (default 60).</param>
+	void setUpdateRate(double const updatesPerSecond_);
+
+	/// <summary>
+	/// Caps the frame rate. Without a cap the loop renders as fast as it can
+	/// (headless loops pace themselves to the update rate regardless).
+	/// </summary>
+	/// <param name="framesPerSecond_">Frames per second; 0 removes the cap.</param>
+	void setFrameRateLimit(double const framesPerSecond_);
+
+	/// <summary>
+	/// Limits how many fixed updates a single frame may run to catch up.
+	/// </summary>
+	/// <param name="maxUpdates_">Maximum updates per frame (default 5).</param>
+	/// <remarks>
+	/// <para>
+	///		After a long stall (debugger, window drag) the accumulator would otherwise
+	///		demand ever more updates per frame than a frame can run - the classic
+	///		spiral of death. Excess accumulated time is dropped instead.
+	/// </para>
+	/// </remarks>
+	void setMaxUpdatesPerFrame(std::uint32_t const maxUpdates_);
+
+	/// <summary>
+	/// Runs the loop on the calling thread until <see cref="stop"/> is called.
+	/// </summary>
+	void run();
+
+	/// <summary>
+	/// Requests the loop to exit; the current frame still completes.
+	/// </summary>
+	void stop();
+
+	/// <summary>
+	/// Determines whether the loop is currently running.
+	/// </summary>
+	/// <returns><c>true</c> if inside <see cref="run"/>; otherwise, <c>false</c>.</returns>
+	bool isRunning() const {
+		return m_running.load(std::memory_order_relaxed);
+	}
+
+	/// <summary>
+	/// Returns the fixed simulation delta.
+	/// </summary>
+	/// <returns>Seconds each update advances the simulation by.</returns>
+	double updateDelta() const {
+		return m_updateDelta;
+	}
+
+private:
+
+	/// <summary>
+	/// Blocks until the given time point - sleeps most of it, spins the last stretch.
+	/// </summary>
+	/// <param name="until_">Time point to wait for.</param>
+	static void preciseWait(Clock::time_point const until_);
+
+	double						m_updateDelta	= 1.0 / 60.0;	// fixed simulation step (seconds)
+	double						m_frameDelta	= 0;			// minimal frame duration (0 = uncapped)
+	std::uint32_t				m_maxUpdates	= 5;			// catch-up limit per frame
+	std::atomic<bool>			m_running		{ false };		// cleared by stop()
+};
+
+} // namespace edge
@@ -0,0 +1,256 @@
+// File description:
+// Implements compile-time hashed string identifiers.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+namespace edge
+{
+
+/// <summary>
+/// Computes the 32-bit FNV-1a hash of a string at compile time or runtime.
+/// </summary>
+/// <param name="string_">The string to hash.</param>
+/// <returns>The 32-bit FNV-1a hash of the string.</returns>
+constexpr std::uint32_t hashString32(std::string_view const string_)
+{
+	std::uint32_t hash = 2166136261u;
+	for (char const character : string_)
+	{
+		hash ^= static_cast<std::uint8_t>(character);
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/// <summary>
+/// Computes the 64-bit FNV-1a hash of a string at compile time or runtime.
+/// </summary>
+/// <param name="string_">The string to hash.</param>
+/// <returns>The 64-bit FNV-1a hash of the string.</returns>
+constexpr std::uint64_t hashString64(std::string_view const string_)
+{
+	std::uint64_t hash = 14695981039346656037ull;
+	for (char const character : string_)
+	{
+		hash ^= static_cast<std::uint8_t>(character);
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+/// <summary>
+/// A string identifier reduced to its FNV-1a hash.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Asset names, event names and entity tags compared as std::string keys cost a
+///		character-by-character walk per map node; hashed they become one integer
+///		compare, and a literal hashed at compile time can drive a switch statement:
+///		<code>
+///		switch (eventName.getValue()) {
+///			case HashedString{ "PlayerSpawned" }.getValue(): ...
+///		}
+///		</code>
+/// </para>
+/// <para>
+///		The type is trivially copyable, ordered, and hashable (std::hash passes the
+///		value through), so it drops into std::map and std::unordered_map keys as-is.
+///		A default-constructed identifier has value 0, which no string hashes to -
+///		use it as "no id". In debug builds identifiers built through intern() are
+///		recorded in a process-wide table so getDebugName() can recover the original
+///		text (and hash collisions between different strings are caught by assert);
+///		release builds compile the table away entirely.
+/// </para>
+/// </remarks>
+template <typename HashType>
+class BasicHashedString
+{
+public:
+	static_assert(std::is_same_v<HashType, std::uint32_t> || std::is_same_v<HashType, std::uint64_t>,
+		"BasicHashedString supports only std::uint32_t and std::uint64_t hashes.");
+
+	// The underlying hash value type.
+	using ValueType = HashType;
+
+	/// <summary>
+	/// Initializes an empty identifier (value 0, matching no string).
+	/// </summary>
+	constexpr BasicHashedString() = default;
+
+	/// <summary>
+	/// Initializes the identifier from a string, hashing it (at compile time for literals).
+	/// </summary>
+	/// <param name="string_">The string to identify.</param>
+	constexpr explicit BasicHashedString(std::string_view const string_)
+		: m_value{ BasicHashedString::hash(string_) }
+	{
+	}
+
+	/// <summary>
+	/// Creates an identifier from an already computed hash value.
+	/// </summary>
+	/// <param name="value_">The hash value.</param>
+	/// <returns>Identifier wrapping the value.</returns>
+	static constexpr BasicHashedString fromValue(ValueType const value_)
+	{
+		BasicHashedString result;
+		result.m_value = value_;
+		return result;
+	}
+
+	/// <summary>
+	/// Creates an identifier from a runtime string and, in debug builds, records
+	/// the text for <see cref="getDebugName"/>.
+	/// </summary>
+	/// <param name="string_">The string to identify.</param>
+	/// <returns>Identifier of the string.</returns>
+	static BasicHashedString intern(std::string_view const string_)
+	{
+		BasicHashedString const result{ string_ };
+	#ifdef EDGE_DEBUG
+		debugRegistry().record(result.m_value, string_);
+	#endif
+		return result;
+	}
+
+	/// <summary>
+	/// Returns the hash value (usable as a switch case when the source is a literal).
+	/// </summary>
+	/// <returns>The hash value.</returns>
+	constexpr ValueType getValue() const {
+		return m_value;
+	}
+
+	/// <summary>
+	/// Returns the original text of an interned identifier, or an empty view.
+	/// </summary>
+	/// <returns>The original text, or an empty view in release builds / for non-interned ids.</returns>
+	std::string_view getDebugName() const
+	{
+	#ifdef EDGE_DEBUG
+		return debugRegistry().lookup(m_value);
+	#else
+		return {};
+	#endif
+	}
+
+	/// <summary>
+	/// Determines whether the identifier is non-empty.
+	/// </summary>
+	constexpr explicit operator bool() const {
+		return m_value != ValueType{ 0 };
+	}
+
+	constexpr bool operator==(BasicHashedString const other_) const {
+		return m_value == other_.m_value;
+	}
+	constexpr bool operator!=(BasicHashedString const other_) const {
+		return m_value != other_.m_value;
+	}
+	constexpr bool operator<(BasicHashedString const other_) const {
+		return m_value < other_.m_value;
+	}
+
+private:
+
+	/// <summary>
+	/// Dispatches to the FNV-1a variant matching the hash width.
+	/// </summary>
+	static constexpr ValueType hash(std::string_view const string_)
+	{
+		if constexpr (std::is_same_v<HashType, std::uint32_t>)
+			return hashString32(string_);
+		else
+			return hashString64(string_);
+	}
+
+#ifdef EDGE_DEBUG
+	/// <summary>
+	/// Process-wide hash-to-text table filled by intern() in debug builds.
+	/// </summary>
+	class DebugRegistry
+	{
+	public:
+		void record(ValueType const value_, std::string_view const string_)
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			auto const [it, inserted] = m_names.emplace(value_, std::string{ string_ });
+
+			// # Assertion note:
+			// Two different strings hashing to one value would silently alias two
+			// identifiers - surface it the moment it happens.
+			assert(inserted || it->second == string_);
+			static_cast<void>(it);
+		}
+
+		std::string_view lookup(ValueType const value_)
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			auto const it = m_names.find(value_);
+			return it != m_names.end() ? std::string_view{ it->second } : std::string_view{};
+		}
+
+	private:
+		std::mutex						m_mutex;
+		std::map<ValueType, std::string>	m_names;
+	};
+
+	/// <summary>
+	/// Returns the process-wide debug registry of this hash width.
+	/// </summary>
+	static DebugRegistry& debugRegistry()
+	{
+		static DebugRegistry registry;
+		return registry;
+	}
+#endif
+
+	ValueType m_value = 0;
+};
+
+// 32-bit identifier - half the storage, for tables where collisions are checked.
+using HashedString32	= BasicHashedString<std::uint32_t>;
+// 64-bit identifier - collision-safe default for engine-wide names.
+using HashedString		= BasicHashedString<std::uint64_t>;
+// Common alternative name for the same concept.
+using StringId			= HashedString;
+
+namespace literals
+{
+
+/// <summary>
+/// Builds a 64-bit <see cref="HashedString"/> from a literal: <c>"PlayerSpawned"_hs</c>.
+/// </summary>
+constexpr HashedString operator""_hs(char const* string_, std::size_t const length_)
+{
+	return HashedString{ std::string_view{ string_, length_ } };
+}
+
+/// <summary>
+/// Builds a 32-bit <see cref="HashedString32"/> from a literal: <c>"PlayerSpawned"_hs32</c>.
+/// </summary>
+constexpr HashedString32 operator""_hs32(char const* string_, std::size_t const length_)
+{
+	return HashedString32{ std::string_view{ string_, length_ } };
+}
+
+} // namespace literals
+
+} // namespace edge
+
+namespace std
+{
+
+template <typename HashType>
+struct hash<edge::BasicHashedString<HashType>>
+{
+	std::size_t operator()(edge::BasicHashedString<HashType> const identifier_) const noexcept {
+		// Already uniformly distributed - pass the value through.
+		return static_cast<std::size_t>(identifier_.getValue());
+	}
+};
+
+} // namespace std
@@ -1,4 +1,8 @@
 #pragma once
 
 #include <EDGE/Core/IO/Log.hpp>
+#include <EDGE/Core/IO/AsyncLog.hpp>
+#include <EDGE/Core/IO/BinaryLog.hpp>
+#include <EDGE/Core/IO/MemoryMappedFile.hpp>
+#include <EDGE/Core/IO/AssetStreamer.hpp>
 #include <EDGE/Core/IO/StreamManipulation.hpp>
@@ -0,0 +1,255 @@
+// File description:
+// Implements background asset streaming with a time-budgeted completion pump.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/NonCopyable.hpp>
+#include <EDGE/Core/Span.hpp>
+#include <EDGE/Core/Profiler.hpp>
+#include <EDGE/Core/Concurrency/JobSystem.hpp>
+#include <EDGE/Core/IO/MemoryMappedFile.hpp>
+
+namespace edge
+{
+
+/// <summary>
+/// Streams assets from disk through background read and decode stages, finalizing
+/// them on the caller's thread under a per-frame time budget.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Loading on the render thread with blocking file I/O turns every zone
+///		transition into one long hitch. Each request() here instead runs as two
+///		chained jobs on the <see cref="JobSystem"/>: a read stage that maps the
+///		file (<see cref="MemoryMappedFile"/>, prefetched so page-ins happen off
+///		the hot thread) and a decode stage turning the raw bytes into the typed
+///		asset. Work that must happen on the main thread - GPU upload, registry
+///		insert - is the finalize stage: decoded assets queue up and pump() runs
+///		as many finalizers as fit the given budget (2 ms by default), carrying
+///		the rest over to the next frame.
+/// </para>
+/// <para>
+///		Call pump() once per frame from the <see cref="GameLoop"/> update or
+///		render callback. request() and pump() are meant for one thread (the
+///		owner); the read/decode stages run on workers. Failures (missing file,
+///		decode returning false) mark the handle Failed and never reach the
+///		finalizer. Handles may be dropped freely - the streamer keeps the
+///		request alive until it finished or failed.
+/// </para>
+/// </remarks>
+class AssetStreamer
+	: INonCopyable
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	/// <summary>
+	/// Stage a streaming request is currently in.
+	/// </summary>
+	enum class Stage
+	{
+		Reading,			// waiting for / inside the read job
+		Decoding,			// inside the decode job
+		PendingFinalize,	// decoded, queued for pump()
+		Finished,			// finalized
+		Failed				// file missing or decode rejected the data
+	};
+
+	/// <summary>
+	/// Shared handle to a streaming request (safe to drop or query from the owner thread).
+	/// </summary>
+	class RequestHandle
+	{
+		friend class AssetStreamer;
+	public:
+		RequestHandle() = default;
+
+		/// <summary>
+		/// Determines whether the handle refers to a request.
+		/// </summary>
+		bool isValid() const {
+			return m_status != nullptr;
+		}
+
+		/// <summary>
+		/// Returns stage the request is currently in.
+		/// </summary>
+		/// <returns>Stage the request is currently in.</returns>
+		Stage getStage() const {
+			return m_status->load(std::memory_order_acquire);
+		}
+
+		/// <summary>
+		/// Determines whether the request is done (finalized or failed).
+		/// </summary>
+		bool isDone() const {
+			Stage const stage = this->getStage();
+			return stage == Stage::Finished || stage == Stage::Failed;
+		}
+
+	private:
+		explicit RequestHandle(std::shared_ptr<std::atomic<Stage>> status_)
+			: m_status{ std::move(status_) }
+		{
+		}
+
+		std::shared_ptr<std::atomic<Stage>> m_status;
+	};
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="AssetStreamer"/> class.
+	/// </summary>
+	/// <param name="jobs_">Job system running the read and decode stages (must outlive the streamer).</param>
+	explicit AssetStreamer(JobSystem & jobs_)
+		: m_jobs{ jobs_ }
+	{
+	}
+
+	/// <summary>
+	/// Finalizes an instance of the <see cref="AssetStreamer"/> class - finishes
+	/// background stages, dropping not-yet-run finalizers.
+	/// </summary>
+	~AssetStreamer()
+	{
+		// Background jobs capture shared state only, but they must not outlive
+		// the queue they enqueue into.
+		for (auto const & handle : m_stageJobs)
+			m_jobs.wait(handle);
+	}
+
+	/// <summary>
+	/// Requests an asset: read and decode run on workers, finalize runs in pump().
+	/// </summary>
+	/// <param name="path_">File to stream.</param>
+	/// <param name="decode_">Worker-side stage: bytes to asset; return false to reject.</param>
+	/// <param name="finalize_">Owner-side stage (GPU upload, registry insert...), run under pump()'s budget.</param>
+	/// <returns>Handle for polling the request.</returns>
+	template <typename AssetType>
+	RequestHandle request(std::filesystem::path path_,
+		std::function<bool(Span<std::byte const>, AssetType &)> decode_,
+		std::function<void(AssetType &&)> finalize_)
+	{
+		// Everything the stages touch lives in one shared block, so dropped
+		// handles and the streamer's own lifetime stay independent.
+		struct Payload
+		{
+			std::shared_ptr<std::atomic<Stage>>	status;
+			std::filesystem::path				path;
+			MemoryMappedFile					file;
+			AssetType							asset{};
+		};
+
+		auto payload	= std::make_shared<Payload>();
+		payload->status	= std::make_shared<std::atomic<Stage>>(Stage::Reading);
+		payload->path	= std::move(path_);
+
+		auto const readJob = m_jobs.schedule(
+			[payload] {
+				if (!payload->file.open(payload->path))
+					payload->status->store(Stage::Failed, std::memory_order_release);
+				else
+				{
+					payload->file.prefetch();
+					payload->status->store(Stage::Decoding, std::memory_order_release);
+				}
+			});
+
+		auto const decodeJob = m_jobs.schedule(
+			[this, payload, decode = std::move(decode_), finalize = std::move(finalize_)]() mutable {
+				if (payload->status->load(std::memory_order_acquire) == Stage::Failed)
+					return;
+
+				if (!decode(payload->file.bytes(), payload->asset))
+				{
+					payload->status->store(Stage::Failed, std::memory_order_release);
+					return;
+				}
+
+				payload->file.close();	// raw bytes are no longer needed
+				payload->status->store(Stage::PendingFinalize, std::memory_order_release);
+
+				std::lock_guard<std::mutex> lock{ m_completedMutex };
+				m_completed.push_back(
+					[payload, finalize = std::move(finalize)]() mutable {
+						finalize(std::move(payload->asset));
+						payload->status->store(Stage::Finished, std::memory_order_release);
+					});
+			},
+			{ readJob });
+
+		this->rememberStageJob(decodeJob);
+		return RequestHandle{ payload->status };
+	}
+
+	/// <summary>
+	/// Runs queued finalizers until the time budget is spent, carrying the rest over.
+	/// </summary>
+	/// <param name="budget_">Wall-clock budget; at least one finalizer runs if any is queued.</param>
+	/// <returns>Number of requests finalized.</returns>
+	std::size_t pump(Clock::duration const budget_ = std::chrono::milliseconds{ 2 })
+	{
+		EDGE_PROFILE_SCOPE("AssetStreamer::pump");
+
+		Clock::time_point const deadline = Clock::now() + budget_;
+		std::size_t finalized = 0;
+
+		for (;;)
+		{
+			std::function<void()> finalizer;
+			{
+				std::lock_guard<std::mutex> lock{ m_completedMutex };
+				if (m_completed.empty())
+					break;
+				finalizer = std::move(m_completed.front());
+				m_completed.pop_front();
+			}
+
+			finalizer();
+			++finalized;
+
+			// Budget check after each finalizer: one oversized upload may
+			// overshoot, but the frame never pays for two of them.
+			if (Clock::now() >= deadline)
+				break;
+		}
+
+		return finalized;
+	}
+
+	/// <summary>
+	/// Returns number of decoded requests waiting for pump().
+	/// </summary>
+	/// <returns>Number of decoded requests waiting for pump().</returns>
+	std::size_t pendingFinalizeCount() const
+	{
+		std::lock_guard<std::mutex> lock{ m_completedMutex };
+		return m_completed.size();
+	}
+
+private:
+
+	/// <summary>
+	/// Tracks the final stage job of a request so the destructor can wait for it
+	/// (finished handles are pruned on the fly to keep the list short).
+	/// </summary>
+	void rememberStageJob(JobSystem::JobHandle const & handle_)
+	{
+		m_stageJobs.erase(
+			std::remove_if(m_stageJobs.begin(), m_stageJobs.end(),
+				[this](JobSystem::JobHandle const & job_) { return m_jobs.isFinished(job_); }),
+			m_stageJobs.end());
+		m_stageJobs.push_back(handle_);
+	}
+
+	JobSystem&							m_jobs;
+	std::vector<JobSystem::JobHandle>	m_stageJobs;
+
+	mutable std::mutex					m_completedMutex;
+	std::deque<std::function<void()>>	m_completed;
+};
+
+} // namespace edge
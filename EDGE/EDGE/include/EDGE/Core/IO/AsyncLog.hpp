@@ -0,0 +1,199 @@
+// File description:
+// Implements asynchronous log interfaces - push() only enqueues, a background thread writes.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/IO/Log.hpp>
+#include <EDGE/Core/Concurrency/ConcurrentQueue.hpp>
+#include <EDGE/Core/NonCopyable.hpp>
+
+namespace edge
+{
+
+/// <summary>
+/// Asynchronous log: push() only writes into a lock-free ring buffer,
+/// a background thread drains it and flushes the stream in batches.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Keeps the push() API of <see cref="BasicLogInterface"/> but moves the
+///		stream write (and its syscall) off the caller's thread. Only the writer
+///		thread ever touches the stream; when the ring buffer is full, push()
+///		waits for it to catch up rather than dropping the message. The
+///		destructor drains every pending message.
+/// </para>
+/// </remarks>
+template <typename _valueType>
+class BasicAsyncLogInterface
+	: public BasicLogInterface<_valueType>, INonCopyable
+{
+public:
+	using super				= BasicLogInterface<_valueType>;
+
+	using ValueType			= _valueType;
+	using StringType		= std::basic_string<ValueType>;
+	using StringViewType	= std::basic_string_view<ValueType>;
+	using StreamType		= std::basic_ostream<ValueType>;
+
+	// How many messages the background thread writes before flushing once.
+	constexpr static std::size_t FlushBatchSize = 64;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="BasicAsyncLogInterface"/> class
+	/// and starts the writer thread.
+	/// </summary>
+	/// <param name="output_">The output stream.</param>
+	/// <param name="queueCapacity_">Ring buffer capacity in messages (rounded up to a power of two).</param>
+	BasicAsyncLogInterface(StreamType *output_ = nullptr, std::size_t const queueCapacity_ = 4096)
+		:
+		super{ output_ },
+		m_queue{ queueCapacity_ },
+		m_running{ true },
+		m_writer{ [this] { this->writerLoop(); } }
+	{
+	}
+
+	/// <summary>
+	/// Finalizes an instance of the <see cref="BasicAsyncLogInterface"/> class.
+	/// Writes every still-queued message first.
+	/// </summary>
+	~BasicAsyncLogInterface()
+	{
+		{
+			std::lock_guard<std::mutex> lock{ m_wakeMutex };
+			m_running.store(false, std::memory_order_relaxed);
+		}
+		m_wakeCv.notify_one();
+		m_writer.join();
+	}
+
+	/// <summary>
+	/// Enqueues the specified message for the writer thread.
+	/// </summary>
+	/// <param name="message_">The message.</param>
+	/// <param name="flush_">Kept for API compatibility - the writer flushes per batch anyway.</param>
+	void push(StringViewType const message_, bool const flush_ = true)
+	{
+		(void)flush_;
+
+		// When the ring buffer is full, wait for the writer to catch up -
+		// it is the only thread allowed to touch the stream.
+		while ( !m_queue.tryEnqueue( StringType{ message_ } ) )
+		{
+			m_wakeCv.notify_one();
+			std::this_thread::yield();
+		}
+
+		m_pushed.fetch_add(1, std::memory_order_release);
+		m_wakeCv.notify_one();
+	}
+
+	/// <summary>
+	/// Blocks until every queued message was written, then flushes the stream.
+	/// </summary>
+	void flush()
+	{
+		while ( m_written.load(std::memory_order_acquire) != m_pushed.load(std::memory_order_acquire) )
+			std::this_thread::yield();
+		super::flush();
+	}
+
+private:
+
+	/// <summary>
+	/// Writer thread main loop - drains the ring buffer and flushes once per batch.
+	/// </summary>
+	void writerLoop()
+	{
+		StringType message;
+		for (;;)
+		{
+			std::size_t batch = 0;
+			while (batch < FlushBatchSize && m_queue.tryDequeue(message))
+			{
+				super::push(message, false);
+				m_written.fetch_add(1, std::memory_order_release);
+				batch++;
+			}
+
+			if (batch > 0)
+			{
+				super::flush();
+				continue;
+			}
+
+			if ( !m_running.load(std::memory_order_relaxed) )
+				return;
+
+			// Queue empty - park until the next push. The timeout covers a
+			// notify that raced with the empty check above.
+			std::unique_lock<std::mutex> lock{ m_wakeMutex };
+			m_wakeCv.wait_for( lock, std::chrono::milliseconds{ 1 } );
+		}
+	}
+
+	BoundedConcurrentQueue<StringType>	m_queue;			// pending messages
+	std::atomic<std::uint64_t>			m_pushed	{ 0 };	// messages ever enqueued
+	std::atomic<std::uint64_t>			m_written	{ 0 };	// messages the writer handled
+	std::atomic<bool>					m_running;			// cleared on destruction
+	std::mutex							m_wakeMutex;		// guards writer sleep
+	std::condition_variable				m_wakeCv;			// wakes the writer
+	std::thread							m_writer;			// background writer thread
+};
+
+/// <summary>
+/// Asynchronous variant of <see cref="BasicDebugLogInterface"/>. In release mode implementation is empty.
+/// </summary>
+/// <seealso cref="BasicAsyncLogInterface" />
+template <typename _valueType>
+class BasicAsyncDebugLogInterface
+	: public BasicAsyncLogInterface<_valueType>
+{
+public:
+	using super				= BasicAsyncLogInterface<_valueType>;
+
+	using ValueType			= _valueType;
+	using StringType		= std::basic_string<ValueType>;
+	using StringViewType	= std::basic_string_view<ValueType>;
+	using StreamType		= std::basic_ostream<ValueType>;
+
+
+	// Default constructor is the same.
+	using super::BasicAsyncLogInterface;
+
+	void pushDebug(StringViewType const message_, bool const flush_ = true)
+	{
+	#ifdef EDGE_DEBUG
+		if constexpr (std::is_same_v<ValueType, char>)
+			this->push("[ DEBUG ]: ", false);
+		else if constexpr (std::is_same_v<ValueType, wchar_t>)
+			this->push(L"[ DEBUG ]: ", false);
+		else if constexpr (std::is_same_v<ValueType, char16_t>)
+			this->push(u"[ DEBUG ]: ", false);
+		else if constexpr (std::is_same_v<ValueType, char32_t>)
+			this->push(U"[ DEBUG ]: ", false);
+		else
+			static_assert(std::is_same_v<ValueType, char>, "This string type is not supported.");
+
+		this->push(message_, flush_);
+	#else
+		(void)message_; (void)flush_;
+	#endif
+	}
+};
+
+using AsyncLogInterface			= BasicAsyncLogInterface<std::string::value_type>;
+using AsyncLogInterfaceW		= BasicAsyncLogInterface<std::wstring::value_type>;
+using AsyncLogInterfaceU16		= BasicAsyncLogInterface<std::u16string::value_type>;
+using AsyncLogInterfaceU32		= BasicAsyncLogInterface<std::u32string::value_type>;
+
+using AsyncDebugLogInterface	= BasicAsyncDebugLogInterface<std::string::value_type>;
+using AsyncDebugLogInterfaceW	= BasicAsyncDebugLogInterface<std::wstring::value_type>;
+using AsyncDebugLogInterfaceU16	= BasicAsyncDebugLogInterface<std::u16string::value_type>;
+using AsyncDebugLogInterfaceU32	= BasicAsyncDebugLogInterface<std::u32string::value_type>;
+
+}
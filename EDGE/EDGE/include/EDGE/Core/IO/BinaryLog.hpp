@@ -0,0 +1,188 @@
+// File description:
+// Implements binary structured logging - call sites write raw argument bytes, text is rebuilt offline.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/NonCopyable.hpp>
+
+namespace edge
+{
+
+namespace detail
+{
+
+/// <summary>
+/// Returns the single-character type code a binary log argument is encoded with.
+/// </summary>
+/// <returns>Type code understood by the decoder.</returns>
+template <typename _type>
+constexpr char binaryLogTypeCode()
+{
+	static_assert(std::is_arithmetic_v<_type>,
+		"Binary log arguments must be arithmetic - format strings and objects belong in the text log.");
+
+	if constexpr (std::is_same_v<_type, float>)
+		return 'f';
+	else if constexpr (std::is_same_v<_type, double>)
+		return 'd';
+	else if constexpr (std::is_same_v<_type, bool>)
+		return 'b';
+	else if constexpr (std::is_signed_v<_type>)
+	{
+		switch (sizeof(_type)) {
+			case 1:		return 'c';
+			case 2:		return 's';
+			case 4:		return 'i';
+			default:	return 'q';
+		}
+	}
+	else
+	{
+		switch (sizeof(_type)) {
+			case 1:		return 'C';
+			case 2:		return 'S';
+			case 4:		return 'I';
+			default:	return 'Q';
+		}
+	}
+}
+
+} // namespace detail
+
+/// <summary>
+/// Binary structured log: write() stores only a message id, a timestamp and the
+/// raw argument bytes - no text formatting happens on the hot path.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Call sites register a format descriptor once (typically in a function-local
+///		static) and then log just the argument payload. The descriptor is embedded
+///		in the stream, so the stream is self-describing -
+///		<see cref="binary_log::decode"/> reconstructs readable text offline.
+/// </para>
+/// <para>
+///		Like the rest of the Log.hpp family a single instance is not synchronized;
+///		give each thread its own instance (or serialize externally) when logging
+///		from multiple threads.
+/// </para>
+/// <para>
+///		Typical usage:
+///		<code>
+///		BinaryLogInterface log{ &amp;file };
+///		static auto const moveMsg = log.registerMessage&lt;std::uint32_t, float, float&gt;("entity {} moved to {}, {}");
+///		log.write(moveMsg, entityId, position.x, position.y);
+///		</code>
+/// </para>
+/// </remarks>
+class BinaryLogInterface
+	: INonCopyable
+{
+public:
+
+	using StreamType = std::ostream;
+
+	// Stream prologue: magic followed by the format version.
+	constexpr static char		Magic[4]	= { 'E', 'B', 'L', '\x01' };
+	// Record tags.
+	constexpr static char		DescriptorRecord	= '\x01';
+	constexpr static char		MessageRecord		= '\x02';
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="BinaryLogInterface"/> class
+	/// and writes the stream prologue.
+	/// </summary>
+	/// <param name="output_">The output stream (must be opened in binary mode).</param>
+	BinaryLogInterface(StreamType *output_ = nullptr)
+		: m_output{ output_ }
+	{
+		if (m_output)
+			m_output->write(Magic, sizeof(Magic));
+	}
+
+	/// <summary>
+	/// Registers a message descriptor and embeds it in the stream.
+	/// </summary>
+	/// <param name="format_">Format text; each <c>{}</c> is replaced by the next argument when decoding.</param>
+	/// <returns>Id to pass to <see cref="write"/> together with arguments of exactly the listed types.</returns>
+	template <typename... _Args>
+	std::uint16_t registerMessage(std::string_view const format_)
+	{
+		constexpr char typeCodes[] = { detail::binaryLogTypeCode<_Args>()..., '\0' };
+		constexpr auto argCount = static_cast<std::uint8_t>( sizeof...(_Args) );
+
+		auto const id = m_nextId++;
+		if (m_output)
+		{
+			auto const formatLength = static_cast<std::uint16_t>( std::min<std::size_t>(format_.size(), std::numeric_limits<std::uint16_t>::max()) );
+
+			m_output->put(DescriptorRecord);
+			m_output->write(reinterpret_cast<char const*>(&id), sizeof(id));
+			m_output->write(reinterpret_cast<char const*>(&formatLength), sizeof(formatLength));
+			m_output->write(format_.data(), formatLength);
+			m_output->put(static_cast<char>(argCount));
+			m_output->write(typeCodes, argCount);
+		}
+		return id;
+	}
+
+	/// <summary>
+	/// Writes one message: id, timestamp and the raw argument bytes.
+	/// </summary>
+	/// <param name="id_">Id obtained from <see cref="registerMessage"/>.</param>
+	/// <param name="args_">Arguments; types must match the registration exactly.</param>
+	template <typename... _Args>
+	void write(std::uint16_t const id_, _Args const... args_)
+	{
+		if (!m_output)
+			return;
+
+		auto const timestamp = static_cast<std::uint64_t>(
+			std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch() ).count() );
+
+		// The whole record is assembled on the stack and written with a single
+		// stream call - the hot path pays one memcpy per argument and no formatting.
+		constexpr std::size_t payloadSize = (std::size_t{ 0 } + ... + sizeof(_Args));
+		char record[1 + sizeof(id_) + sizeof(timestamp) + payloadSize + 1]; // +1 keeps zero-arg messages legal
+
+		std::size_t offset = 0;
+		record[offset++] = MessageRecord;
+		std::memcpy(record + offset, &id_, sizeof(id_));			offset += sizeof(id_);
+		std::memcpy(record + offset, &timestamp, sizeof(timestamp));	offset += sizeof(timestamp);
+		( (std::memcpy(record + offset, &args_, sizeof(args_)), offset += sizeof(args_)), ... );
+
+		m_output->write(record, offset);
+	}
+
+	/// <summary>
+	/// Flushes the stream.
+	/// </summary>
+	void flush() {
+		if (m_output) {
+			m_output->flush();
+		}
+	}
+
+private:
+	StreamType *	m_output;
+	std::uint16_t	m_nextId = 0;
+};
+
+namespace binary_log
+{
+
+/// <summary>
+/// Offline decoder: reconstructs readable text from a binary log stream.
+/// </summary>
+/// <param name="input_">Stream produced by <see cref="BinaryLogInterface"/> (binary mode).</param>
+/// <param name="output_">Receives one <c>[timestamp] text</c> line per message.</param>
+/// <returns><c>true</c> if the whole stream decoded cleanly; <c>false</c> on a malformed stream.</returns>
+bool decode(std::istream & input_, std::ostream & output_);
+
+} // namespace binary_log
+
+}
@@ -98,9 +98,9 @@ public:
 		else if constexpr (std::is_same_v<ValueType, char32_t>)
 			this->push(U"[ DEBUG ]: ", false);
 		else
-			static_assert(false, "This string type is not supported.");
+			static_assert(std::is_same_v<ValueType, char>, "This string type is not supported.");
 
-		this->push(message_, flush);
+		this->push(message_, flush_);
 	#endif
 	}
 };
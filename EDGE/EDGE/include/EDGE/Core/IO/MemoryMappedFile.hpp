@@ -0,0 +1,148 @@
+// File description:
+// Implements zero-copy read-only file access through memory mapping.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/NonCopyable.hpp>
+#include <EDGE/Core/Span.hpp>
+
+namespace edge
+{
+
+/// <summary>
+/// Read-only view of a whole file mapped into the address space.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Loaders parse directly from the page cache instead of copying every byte
+///		through stream buffers - for multi-gigabyte world files the difference is
+///		the whole copy. Binary formats can point their structures straight at
+///		<see cref="bytes"/>; the view stays valid until close() or destruction.
+/// </para>
+/// <para>
+///		Backed by CreateFileMapping/MapViewOfFile on Windows and mmap elsewhere.
+///		Mapping is lazy per page - use <see cref="prefetch"/> to hint the upcoming
+///		range so a sequential parse does not fault page by page.
+/// </para>
+/// </remarks>
+class EDGE_API MemoryMappedFile
+	: INonCopyable
+{
+public:
+
+	/// <summary>
+	/// Initializes a new (unmapped) instance of the <see cref="MemoryMappedFile"/> class.
+	/// </summary>
+	MemoryMappedFile() = default;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="MemoryMappedFile"/> class and maps the file.
+	/// Check <see cref="isOpen"/> afterwards.
+	/// </summary>
+	/// <param name="path_">Path of the file to map.</param>
+	explicit MemoryMappedFile(std::filesystem::path const & path_)
+	{
+		this->open(path_);
+	}
+
+	/// <summary>
+	/// Moves the mapping out of another instance (which becomes unmapped).
+	/// </summary>
+	/// <param name="other_">The moved-from instance.</param>
+	MemoryMappedFile(MemoryMappedFile && other_) noexcept;
+
+	/// <summary>
+	/// Move-assigns the mapping, closing the current one first.
+	/// </summary>
+	/// <param name="other_">The moved-from instance.</param>
+	/// <returns>Reference to self.</returns>
+	MemoryMappedFile& operator=(MemoryMappedFile && other_) noexcept;
+
+	/// <summary>
+	/// Finalizes an instance of the <see cref="MemoryMappedFile"/> class - unmaps the file.
+	/// </summary>
+	~MemoryMappedFile();
+
+	/// <summary>
+	/// Maps the specified file for reading, closing any previous mapping.
+	/// </summary>
+	/// <param name="path_">Path of the file to map.</param>
+	/// <returns><c>true</c> when the file was mapped; otherwise, <c>false</c>.</returns>
+	/// <remarks>
+	/// <para>An existing empty file maps successfully to an empty view.</para>
+	/// </remarks>
+	bool open(std::filesystem::path const & path_);
+
+	/// <summary>
+	/// Unmaps the file. Every pointer into the view becomes invalid.
+	/// </summary>
+	void close();
+
+	/// <summary>
+	/// Determines whether a file is currently mapped.
+	/// </summary>
+	/// <returns><c>true</c> if a file is mapped; otherwise, <c>false</c>.</returns>
+	bool isOpen() const {
+		return m_open;
+	}
+
+	/// <summary>
+	/// Returns the whole file content as a read-only byte view.
+	/// </summary>
+	/// <returns>The mapped bytes (empty when nothing is mapped).</returns>
+	Span<std::byte const> bytes() const {
+		return Span<std::byte const>{ static_cast<std::byte const*>(m_data), m_size };
+	}
+
+	/// <summary>
+	/// Returns the whole file content as a read-only character view (for text parsers).
+	/// </summary>
+	/// <returns>The mapped characters (empty when nothing is mapped).</returns>
+	Span<char const> chars() const {
+		return Span<char const>{ static_cast<char const*>(m_data), m_size };
+	}
+
+	/// <summary>
+	/// Returns pointer to the first mapped byte.
+	/// </summary>
+	/// <returns>Pointer to the first mapped byte, or null when nothing is mapped.</returns>
+	std::byte const* data() const {
+		return static_cast<std::byte const*>(m_data);
+	}
+
+	/// <summary>
+	/// Returns the mapped file size in bytes.
+	/// </summary>
+	/// <returns>The mapped file size in bytes.</returns>
+	std::size_t size() const {
+		return m_size;
+	}
+
+	/// <summary>
+	/// Hints the OS to read the specified range ahead of use (whole file by default).
+	/// </summary>
+	/// <param name="offset_">First byte of the range.</param>
+	/// <param name="length_">Range length; 0 extends to the end of the file.</param>
+	/// <remarks>
+	/// <para>Purely advisory - sequential parsers should hint the next chunk before
+	/// working on the current one so page-in overlaps the parse.</para>
+	/// </remarks>
+	void prefetch(std::size_t offset_ = 0, std::size_t length_ = 0) const;
+
+private:
+
+	void*		m_data	= nullptr;
+	std::size_t	m_size	= 0;
+	bool		m_open	= false;
+
+	// Platform handles (unused fields stay at their defaults on the other platform).
+	void*		m_fileHandle	= nullptr;	// Windows: file HANDLE
+	void*		m_mappingHandle	= nullptr;	// Windows: file mapping HANDLE
+	int			m_fileDescriptor = -1;		// POSIX: file descriptor
+};
+
+} // namespace edge
@@ -1,8 +1,14 @@
 #pragma once
 
+#include <EDGE/Core/Math/Philox.hpp>
 #include <EDGE/Core/Math/Random.hpp>
 #include <EDGE/Core/Math/MathHelper.hpp>
+#include <EDGE/Core/Math/FastMath.hpp>
 #include <EDGE/Core/Math/Length.hpp>
 #include <EDGE/Core/Math/Vector2.hpp>
+#include <EDGE/Core/Math/VectorExpression.hpp>
 #include <EDGE/Core/Math/Vector3.hpp>
+#include <EDGE/Core/Math/VectorSimd.hpp>
+#include <EDGE/Core/Math/VectorBatch.hpp>
 #include <EDGE/Core/Math/VectorStringBuilder.hpp>
+#include <EDGE/Core/Math/SpatialHashGrid.hpp>
@@ -0,0 +1,223 @@
+// File description:
+// Implements fast approximate transcendental functions (Math::Fast family).
+// Each function is tiered by an Accuracy parameter whose error bound maps onto
+// the tolerance constants from MathHelper.hpp, so precision can be picked per call site.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/Math/MathHelper.hpp>
+
+namespace edge
+{
+
+namespace Math
+{
+
+namespace Fast
+{
+
+/// <summary>
+/// Accuracy tier of the approximations below.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Coarse:	absolute error on the order of Constants::VeryHighTolerance (1e-3).
+///		Fine:	absolute error on the order of Constants::MediumTolerance (1e-5), at roughly twice the cost.
+/// </para>
+/// </remarks>
+enum class Accuracy
+{
+	Coarse,
+	Fine
+};
+
+namespace detail
+{
+
+// Wraps angle to [-Pi, Pi).
+template <typename FloatType>
+inline FloatType reducePi(FloatType const angle_)
+{
+	constexpr FloatType pi		= Constants::Pi<FloatType>;
+	constexpr FloatType twoPi	= FloatType{ 2 } * Constants::Pi<FloatType>;
+	return angle_ - twoPi * std::floor((angle_ + pi) / twoPi);
+}
+
+// Polynomial sine on [-Pi/2, Pi/2] (9th order, abs error < 3e-6).
+template <typename FloatType>
+inline FloatType sinPoly(FloatType const x_)
+{
+	FloatType const sq = x_ * x_;
+	return x_ * (FloatType{ 1 }
+		+ sq * (FloatType{ -1.0 / 6.0 }
+		+ sq * (FloatType{ 1.0 / 120.0 }
+		+ sq * (FloatType{ -1.0 / 5040.0 }
+		+ sq *  FloatType{ 1.0 / 362880.0 }))));
+}
+
+// Polynomial arctangent on [-1, 1] (Abramowitz-Stegun 4.4.49, abs error < 1e-5).
+template <typename FloatType>
+inline FloatType atanPolyFine(FloatType const z_)
+{
+	FloatType const sq = z_ * z_;
+	return z_ * (FloatType{ 0.9998660 }
+		+ sq * (FloatType{ -0.3302995 }
+		+ sq * (FloatType{ 0.1801410 }
+		+ sq * (FloatType{ -0.0851330 }
+		+ sq *  FloatType{ 0.0208351 }))));
+}
+
+// Quadratic arctangent on [-1, 1] (abs error < 0.005 rad).
+template <typename FloatType>
+inline FloatType atanPolyCoarse(FloatType const z_)
+{
+	constexpr FloatType quarterPi = Constants::Pi<FloatType> / FloatType{ 4 };
+	return quarterPi * z_ + FloatType{ 0.273 } * z_ * (FloatType{ 1 } - std::abs(z_));
+}
+
+} // namespace detail
+
+/// <summary>
+/// Computes approximate sine of an angle (radians, any range).
+/// </summary>
+/// <param name="angle_">The angle in radians.</param>
+/// <returns>Approximate sine of the angle.</returns>
+/// <remarks>
+/// <para>
+///		Coarse:	abs error &lt; 1.1e-3 (about Constants::VeryHighTolerance).
+///		Fine:	abs error &lt; 4e-6 (below Constants::MediumTolerance).
+/// </para>
+/// </remarks>
+template <Accuracy _accuracy = Accuracy::Coarse, typename FloatType>
+inline FloatType fastSin(FloatType const angle_)
+{
+	static_assert(std::is_floating_point_v<FloatType>, "fastSin requires a floating point type.");
+
+	constexpr FloatType pi		= Constants::Pi<FloatType>;
+	FloatType const reduced		= detail::reducePi(angle_);
+
+	if constexpr (_accuracy == Accuracy::Coarse)
+	{
+		// Parabolic approximation with one precision-restoring step.
+		constexpr FloatType b = FloatType{ 4 } / pi;
+		constexpr FloatType c = FloatType{ -4 } / (pi * pi);
+
+		FloatType y = b * reduced + c * reduced * std::abs(reduced);
+		return FloatType{ 0.225 } * (y * std::abs(y) - y) + y;
+	}
+	else
+	{
+		// Fold [-Pi, Pi) onto [-Pi/2, Pi/2] and evaluate the polynomial there.
+		FloatType x = reduced;
+		if (x > pi / FloatType{ 2 })
+			x = pi - x;
+		else if (x < -pi / FloatType{ 2 })
+			x = -pi - x;
+		return detail::sinPoly(x);
+	}
+}
+
+/// <summary>
+/// Computes approximate cosine of an angle (radians, any range).
+/// </summary>
+/// <param name="angle_">The angle in radians.</param>
+/// <returns>Approximate cosine of the angle.</returns>
+/// <remarks>
+/// <para>Error bounds are identical to <see cref="fastSin"/>.</para>
+/// </remarks>
+template <Accuracy _accuracy = Accuracy::Coarse, typename FloatType>
+inline FloatType fastCos(FloatType const angle_)
+{
+	static_assert(std::is_floating_point_v<FloatType>, "fastCos requires a floating point type.");
+	return fastSin<_accuracy>(angle_ + Constants::Pi<FloatType> / FloatType{ 2 });
+}
+
+/// <summary>
+/// Computes approximate atan2(y, x).
+/// </summary>
+/// <param name="y_">The y component.</param>
+/// <param name="x_">The x component.</param>
+/// <returns>Approximate angle of the vector (x, y) in radians, range (-Pi, Pi].</returns>
+/// <remarks>
+/// <para>
+///		Coarse:	abs error &lt; 0.005 rad (a few multiples of Constants::VeryHighTolerance).
+///		Fine:	abs error &lt; 1.2e-5 rad (about Constants::MediumTolerance).
+///		Returns 0 for (0, 0), like std::atan2.
+/// </para>
+/// </remarks>
+template <Accuracy _accuracy = Accuracy::Coarse, typename FloatType>
+inline FloatType fastAtan2(FloatType const y_, FloatType const x_)
+{
+	static_assert(std::is_floating_point_v<FloatType>, "fastAtan2 requires a floating point type.");
+
+	constexpr FloatType pi		= Constants::Pi<FloatType>;
+	constexpr FloatType halfPi	= Constants::Pi<FloatType> / FloatType{ 2 };
+
+	if (x_ == FloatType{ 0 } && y_ == FloatType{ 0 })
+		return FloatType{ 0 };
+
+	FloatType const absX = std::abs(x_);
+	FloatType const absY = std::abs(y_);
+
+	// Evaluate the polynomial on [-1, 1] and unfold to the proper octant.
+	FloatType const z = (absY <= absX) ? (absY / absX) : (absX / absY);
+
+	FloatType angle;
+	if constexpr (_accuracy == Accuracy::Coarse)
+		angle = detail::atanPolyCoarse(z);
+	else
+		angle = detail::atanPolyFine(z);
+
+	if (absY > absX)
+		angle = halfPi - angle;
+	if (x_ < FloatType{ 0 })
+		angle = pi - angle;
+	return (y_ < FloatType{ 0 }) ? -angle : angle;
+}
+
+/// <summary>
+/// Computes approximate 1 / sqrt(value) using the bit-trick estimate with Newton-Raphson refinement.
+/// </summary>
+/// <param name="value_">The value (must be &gt; 0).</param>
+/// <returns>Approximate reciprocal square root of the value.</returns>
+/// <remarks>
+/// <para>
+///		Coarse:	one refinement step, rel error &lt; 2e-3 (about 2x Constants::VeryHighTolerance).
+///		Fine:	two refinement steps, rel error &lt; 5e-6 (below Constants::MediumTolerance).
+/// </para>
+/// </remarks>
+template <Accuracy _accuracy = Accuracy::Coarse, typename FloatType>
+inline FloatType fastInvSqrt(FloatType const value_)
+{
+	static_assert(std::is_same_v<FloatType, float> || std::is_same_v<FloatType, double>,
+		"fastInvSqrt supports float and double only.");
+
+	using BitsType = std::conditional_t< std::is_same_v<FloatType, float>, std::uint32_t, std::uint64_t >;
+
+	constexpr BitsType cxprMagic = static_cast<BitsType>(
+		std::is_same_v<FloatType, float> ? 0x5F375A86ull : 0x5FE6EB50C7B537A9ull
+	);
+
+	BitsType bits;
+	std::memcpy(&bits, &value_, sizeof(FloatType));
+	bits = cxprMagic - (bits >> 1);
+
+	FloatType estimate;
+	std::memcpy(&estimate, &bits, sizeof(FloatType));
+
+	FloatType const halfValue = FloatType{ 0.5 } * value_;
+	estimate = estimate * (FloatType{ 1.5 } - halfValue * estimate * estimate);
+	if constexpr (_accuracy == Accuracy::Fine)
+		estimate = estimate * (FloatType{ 1.5 } - halfValue * estimate * estimate);
+	return estimate;
+}
+
+} // namespace Fast
+
+} // namespace Math
+
+} // namespace edge
@@ -5,6 +5,9 @@
 // Precompiled header:
 #include EDGE_PCH
 
+// Custom includes:
+#include <EDGE/Core/Math/MathHelper.hpp>	// For Math::nearlyEquals and the tolerance constants.
+
 namespace edge
 {
 template<class NonRatioType>
@@ -85,6 +88,7 @@ public:
 		value = rhs_.value
 			* std::ratio_divide<RatioType2nd, RatioType>::num
 			/ std::ratio_divide<RatioType2nd, RatioType>::den;
+		return *this;
 	}
 
 	/// <summary>
@@ -310,6 +314,11 @@ constexpr bool operator<=(BaseLength<LengthType1st, RatioType1st> const & lhs_,
 }
 
 
+// Explicit instantiation declarations for the most commonly used types.
+// Definitions live in src/EDGE/Core/Math/Length.cpp - other TUs don't re-instantiate them.
+extern template class BaseLength<float>;
+extern template class BaseLength<double>;
+
 using Nanometers	= BaseLength<double, std::nano>;		// 0.000'000'001m
 using Micrometers	= BaseLength<double, std::micro>;		// 0.000'001m
 using Millimeters	= BaseLength<double, std::milli>;		// 0.001m
@@ -43,6 +43,108 @@ constexpr Type VeryHighTolerance	= static_cast<Type>(0.001);
 
 } // namespace Constants
 
+/// <summary>
+/// Computes square root of the value. Usable in constant expressions.
+/// </summary>
+/// <param name="value_">The value.</param>
+/// <returns>Square root of the value (NaN for negative input).</returns>
+/// <remarks>
+/// <para>
+///		Scales the value into [0.25, 1) and runs Newton-Raphson to full precision
+///		(converges in a handful of iterations). At runtime prefer std::sqrt on hot
+///		paths - this function exists so unit-vector constants and direction tables
+///		can be computed at compile time.
+/// </para>
+/// </remarks>
+template <typename Type>
+constexpr Type sqrt(Type const value_)
+{
+	static_assert(std::is_arithmetic_v<Type>, "Math::sqrt requires an arithmetic type.");
+
+	if constexpr (std::is_integral_v<Type>)
+	{
+		return static_cast<Type>( Math::sqrt<double>( static_cast<double>(value_) ) );
+	}
+	else
+	{
+		if (value_ < Type{ 0 })
+			return std::numeric_limits<Type>::quiet_NaN();
+		if (value_ == Type{ 0 } || value_ == std::numeric_limits<Type>::infinity())
+			return value_;
+
+		// Scale into [0.25, 1); `scale` accumulates the square root of the removed factor.
+		Type scaled = value_;
+		Type scale	= Type{ 1 };
+		while (scaled >= Type{ 1 }) {
+			scaled /= Type{ 4 };
+			scale  *= Type{ 2 };
+		}
+		while (scaled < Type{ 0.25 }) {
+			scaled *= Type{ 4 };
+			scale  /= Type{ 2 };
+		}
+
+		// Newton-Raphson; quadratic convergence from a mid-range initial guess.
+		Type estimate = Type{ 0.6 };
+		for (int i = 0; i < 16; ++i)
+		{
+			Type const next = (estimate + scaled / estimate) / Type{ 2 };
+			if (next == estimate)
+				break;
+			estimate = next;
+		}
+		return estimate * scale;
+	}
+}
+
+/// <summary>
+/// Computes sine of an angle (radians). Usable in constant expressions.
+/// </summary>
+/// <param name="angle_">The angle in radians.</param>
+/// <returns>Sine of the angle.</returns>
+/// <remarks>
+/// <para>Taylor series summed to full precision after range reduction to [-Pi, Pi].</para>
+/// </remarks>
+template <typename Type>
+constexpr Type sin(Type const angle_)
+{
+	static_assert(std::is_floating_point_v<Type>, "Math::sin requires a floating point type.");
+
+	constexpr Type pi		= Constants::Pi<Type>;
+	constexpr Type twoPi	= Type{ 2 } * Constants::Pi<Type>;
+
+	Type x = angle_;
+	while (x > pi)
+		x -= twoPi;
+	while (x < -pi)
+		x += twoPi;
+
+	// Taylor series: sum x^(2k+1) * (-1)^k / (2k+1)! until terms vanish.
+	Type term	= x;
+	Type sum	= x;
+	for (int k = 1; k < 32; ++k)
+	{
+		term *= -(x * x) / static_cast<Type>((2 * k) * (2 * k + 1));
+		Type const next = sum + term;
+		if (next == sum)
+			break;
+		sum = next;
+	}
+	return sum;
+}
+
+/// <summary>
+/// Computes cosine of an angle (radians). Usable in constant expressions.
+/// </summary>
+/// <param name="angle_">The angle in radians.</param>
+/// <returns>Cosine of the angle.</returns>
+template <typename Type>
+constexpr Type cos(Type const angle_)
+{
+	static_assert(std::is_floating_point_v<Type>, "Math::cos requires a floating point type.");
+	return Math::sin(angle_ + Constants::Pi<Type> / Type{ 2 });
+}
+
 /// <summary>
 /// Makes sure that `lower_` is <= `higher_`.
 /// </summary>
@@ -0,0 +1,296 @@
+// File description:
+// Implements a spatial hash grid for broad-phase proximity queries.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/Span.hpp>
+#include <EDGE/Core/Math/Vector2.hpp>
+
+namespace edge
+{
+
+/// <summary>
+/// Uniform spatial hash grid over 2D positions for broad-phase proximity queries.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Replaces brute-force O(n²) pair checks: items are bucketed by the grid cell
+///		their position falls into, so a circle or box query only touches the cells
+///		the query overlaps. The grid is rebuilt from scratch each tick (a counting
+///		sort into flat arrays - two passes, no per-item allocation), which for
+///		moving entities is cheaper and simpler than incremental updates.
+/// </para>
+/// <para>
+///		Cells are hashed into a power-of-two table, so the grid is unbounded -
+///		positions may be anywhere, only occupied cells cost memory. Hash collisions
+///		between distant cells merely co-locate their items in one bucket; every
+///		entry carries its exact cell key and position, so queries never return
+///		false positives. All storage is reused between rebuilds; queries either
+///		visit items via a callback or append to a caller-owned vector, allocating
+///		nothing per query once the vector has warmed up.
+/// </para>
+/// <para>
+///		Pick <c>cellSize_</c> near the diameter of a typical query: much smaller
+///		wastes time walking cells, much larger degenerates toward a linear scan.
+///		Not synchronized - rebuild and queries must not overlap across threads
+///		(concurrent queries alone are fine).
+/// </para>
+/// </remarks>
+template <typename ItemType, typename VectorType = float>
+class SpatialHashGrid
+{
+public:
+	// The vector type positions are expressed in.
+	using Vector = BaseVector2<VectorType>;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="SpatialHashGrid"/> class.
+	/// </summary>
+	/// <param name="cellSize_">Edge length of one grid cell, in world units.</param>
+	explicit SpatialHashGrid(VectorType const cellSize_ = VectorType{ 64 })
+		: m_cellSize{ cellSize_ }
+	{
+		// # Assertion note:
+		// A non-positive cell size would collapse every position into one cell.
+		assert(cellSize_ > VectorType{ 0 });
+	}
+
+	/// <summary>
+	/// Rebuilds the grid from parallel spans of positions and items.
+	/// </summary>
+	/// <param name="positions_">Position of every item.</param>
+	/// <param name="items_">The items (handles, indices...) themselves.</param>
+	void rebuild(Span<Vector const> positions_, Span<ItemType const> items_)
+	{
+		// # Assertion note:
+		// Spans are parallel arrays - positions_[i] belongs to items_[i].
+		assert(positions_.size() == items_.size());
+
+		std::size_t const count = positions_.size();
+
+		// Table of at least 2x the item count keeps buckets short; power of two
+		// so the hash reduces with a mask instead of a modulo.
+		std::size_t tableSize = 16;
+		while (tableSize < count * 2)
+			tableSize *= 2;
+
+		m_bucketStart.assign(tableSize + 1, 0);
+		m_entries.resize(count);
+		m_tableMask = tableSize - 1;
+
+		// Pass 1: count items per bucket.
+		for (std::size_t i = 0; i < count; ++i)
+			++m_bucketStart[this->bucketOf(this->cellKeyOf(positions_[i]))];
+
+		// Exclusive prefix sum: m_bucketStart[b] becomes the first entry index of bucket b.
+		std::size_t runningTotal = 0;
+		for (std::size_t b = 0; b <= tableSize; ++b)
+		{
+			std::size_t const bucketCount = m_bucketStart[b];
+			m_bucketStart[b] = runningTotal;
+			runningTotal += bucketCount;
+		}
+
+		// Pass 2: scatter entries into their buckets. A scratch copy of the
+		// bucket starts serves as write cursors so m_bucketStart stays intact.
+		m_bucketCursor.assign(m_bucketStart.begin(), m_bucketStart.end() - 1);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			std::uint64_t const cell = this->cellKeyOf(positions_[i]);
+			Entry & entry	= m_entries[m_bucketCursor[this->bucketOf(cell)]++];
+			entry.cell		= cell;
+			entry.position	= positions_[i];
+			entry.item		= items_[i];
+		}
+	}
+
+	/// <summary>
+	/// Removes every item (storage is kept for reuse).
+	/// </summary>
+	void clear()
+	{
+		m_bucketStart.assign(m_bucketStart.size(), 0);
+		m_entries.clear();
+	}
+
+	/// <summary>
+	/// Invokes the visitor for every item within the given radius of the center.
+	/// </summary>
+	/// <param name="center_">Center of the query circle.</param>
+	/// <param name="radius_">Radius of the query circle.</param>
+	/// <param name="visitor_">Callable invoked as visitor_(item, position).</param>
+	template <typename VisitorType>
+	void forEachInCircle(Vector const center_, VectorType const radius_, VisitorType visitor_) const
+	{
+		VectorType const radiusSquared = radius_ * radius_;
+
+		this->forEachCellIn(center_ - Vector{ radius_, radius_ }, center_ + Vector{ radius_, radius_ },
+			[&](Entry const & entry_)
+			{
+				if (entry_.position.distanceSquared(center_) <= radiusSquared)
+					visitor_(entry_.item, entry_.position);
+			});
+	}
+
+	/// <summary>
+	/// Invokes the visitor for every item inside the given axis-aligned box.
+	/// </summary>
+	/// <param name="min_">Minimum corner of the box.</param>
+	/// <param name="max_">Maximum corner of the box.</param>
+	/// <param name="visitor_">Callable invoked as visitor_(item, position).</param>
+	template <typename VisitorType>
+	void forEachInAABB(Vector const min_, Vector const max_, VisitorType visitor_) const
+	{
+		this->forEachCellIn(min_, max_,
+			[&](Entry const & entry_)
+			{
+				if (entry_.position.x >= min_.x && entry_.position.x <= max_.x &&
+					entry_.position.y >= min_.y && entry_.position.y <= max_.y)
+				{
+					visitor_(entry_.item, entry_.position);
+				}
+			});
+	}
+
+	/// <summary>
+	/// Appends every item within the given radius of the center to the results vector.
+	/// </summary>
+	/// <param name="center_">Center of the query circle.</param>
+	/// <param name="radius_">Radius of the query circle.</param>
+	/// <param name="results_">Receives matching items; not cleared first.</param>
+	void queryCircle(Vector const center_, VectorType const radius_, std::vector<ItemType> & results_) const
+	{
+		this->forEachInCircle(center_, radius_,
+			[&results_](ItemType const & item_, Vector const &) { results_.push_back(item_); });
+	}
+
+	/// <summary>
+	/// Appends every item inside the given axis-aligned box to the results vector.
+	/// </summary>
+	/// <param name="min_">Minimum corner of the box.</param>
+	/// <param name="max_">Maximum corner of the box.</param>
+	/// <param name="results_">Receives matching items; not cleared first.</param>
+	void queryAABB(Vector const min_, Vector const max_, std::vector<ItemType> & results_) const
+	{
+		this->forEachInAABB(min_, max_,
+			[&results_](ItemType const & item_, Vector const &) { results_.push_back(item_); });
+	}
+
+	/// <summary>
+	/// Returns number of items in the grid.
+	/// </summary>
+	/// <returns>Number of items in the grid.</returns>
+	std::size_t size() const {
+		return m_entries.size();
+	}
+
+	/// <summary>
+	/// Returns edge length of one grid cell.
+	/// </summary>
+	/// <returns>Edge length of one grid cell.</returns>
+	VectorType getCellSize() const {
+		return m_cellSize;
+	}
+
+private:
+
+	/// <summary>
+	/// One stored item together with its exact cell and position.
+	/// </summary>
+	struct Entry
+	{
+		std::uint64_t	cell;
+		Vector			position;
+		ItemType		item;
+	};
+
+	/// <summary>
+	/// Returns cell coordinate of a scalar position (floor division by the cell size).
+	/// </summary>
+	std::int32_t cellCoord(VectorType const value_) const
+	{
+		if constexpr (std::is_floating_point_v<VectorType>)
+			return static_cast<std::int32_t>(std::floor(value_ / m_cellSize));
+		else
+		{
+			// Integer floor division (round toward negative infinity).
+			auto const quotient = value_ / m_cellSize;
+			if constexpr (std::is_signed_v<VectorType>)
+				return static_cast<std::int32_t>(value_ % m_cellSize != 0 && value_ < VectorType{ 0 } ? quotient - 1 : quotient);
+			else
+				return static_cast<std::int32_t>(quotient);
+		}
+	}
+
+	/// <summary>
+	/// Packs both cell coordinates of a position into one 64-bit key.
+	/// </summary>
+	std::uint64_t cellKeyOf(Vector const position_) const
+	{
+		return this->cellKey(this->cellCoord(position_.x), this->cellCoord(position_.y));
+	}
+
+	/// <summary>
+	/// Packs a pair of cell coordinates into one 64-bit key.
+	/// </summary>
+	static std::uint64_t cellKey(std::int32_t const cellX_, std::int32_t const cellY_)
+	{
+		return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cellX_)) << 32)
+			| static_cast<std::uint32_t>(cellY_);
+	}
+
+	/// <summary>
+	/// Maps a cell key to its bucket in the hash table.
+	/// </summary>
+	std::size_t bucketOf(std::uint64_t const cellKey_) const
+	{
+		// Two large primes decorrelate the coordinate halves before masking.
+		std::uint64_t const hash = static_cast<std::uint32_t>(cellKey_ >> 32) * 73856093u
+			^ static_cast<std::uint32_t>(cellKey_) * 19349663u;
+		return static_cast<std::size_t>(hash) & m_tableMask;
+	}
+
+	/// <summary>
+	/// Invokes the callback for every entry stored in a cell overlapping the box.
+	/// </summary>
+	/// <remarks>
+	///		A bucket shared by several overlapped cells (hash collision) is walked
+	///		once per cell, but the exact cell key check admits each entry exactly once.
+	/// </remarks>
+	template <typename CallbackType>
+	void forEachCellIn(Vector const min_, Vector const max_, CallbackType callback_) const
+	{
+		if (m_entries.empty())
+			return;
+
+		std::int32_t const firstCellX	= this->cellCoord(min_.x);
+		std::int32_t const firstCellY	= this->cellCoord(min_.y);
+		std::int32_t const lastCellX	= this->cellCoord(max_.x);
+		std::int32_t const lastCellY	= this->cellCoord(max_.y);
+
+		for (std::int32_t cellY = firstCellY; cellY <= lastCellY; ++cellY)
+			for (std::int32_t cellX = firstCellX; cellX <= lastCellX; ++cellX)
+			{
+				std::uint64_t const cell	= cellKey(cellX, cellY);
+				std::size_t const bucket	= this->bucketOf(cell);
+
+				for (std::size_t i = m_bucketStart[bucket]; i < m_bucketStart[bucket + 1]; ++i)
+					if (m_entries[i].cell == cell)
+						callback_(m_entries[i]);
+			}
+	}
+
+	VectorType					m_cellSize;
+	std::size_t					m_tableMask = 0;
+	// m_bucketStart[b]..m_bucketStart[b + 1] indexes the entries of bucket b.
+	std::vector<std::size_t>	m_bucketStart;
+	// Rebuild scratch (write cursors) - a member so its allocation is reused.
+	std::vector<std::size_t>	m_bucketCursor;
+	std::vector<Entry>			m_entries;
+};
+
+} // namespace edge
@@ -10,6 +10,7 @@
 // Custom includes:
 #include <EDGE/Core/TypeTraits.hpp>
 #include <EDGE/Core/Math/MathHelper.hpp>
+#include <EDGE/Core/Math/VectorSimd.hpp>
 #include <EDGE/Core/Math/VectorStringBuilder.hpp>
 
 namespace edge
@@ -213,16 +214,29 @@ public:
 	/// Returns length of the vector.
 	/// </summary>
 	/// <returns>Length of the vector.</returns>
+	/// <remarks>
+	/// <para>
+	///		Usable in constant expressions (via Math::sqrt), except for the float
+	///		instantiation on SSE targets, which takes the runtime SIMD path.
+	/// </para>
+	/// </remarks>
 	template <typename LengthType = ValueType,
 		typename = std::enable_if_t< is_mathscalar_v<LengthType> > >
-	LengthType length() const
+	constexpr LengthType length() const
 	{
 		if constexpr(std::is_same_v<LengthType, ValueType>)
-			return std::sqrt(x * x + y * y + z * z);
+		{
+		#if EDGE_SIMD_SSE
+			// SSE specialization of the float instantiation (see VectorSimd.hpp).
+			if constexpr(std::is_same_v<ValueType, float>)
+				return Math::simd::length3(x, y, z);
+		#endif
+			return Math::sqrt(x * x + y * y + z * z);
+		}
 		else
 		{
 			auto conv = this->template convert<LengthType>();
-			return std::sqrt(conv.x * conv.x + conv.y * conv.y + conv.z * conv.z);
+			return Math::sqrt(conv.x * conv.x + conv.y * conv.y + conv.z * conv.z);
 		}
 	}
 
@@ -250,7 +264,7 @@ public:
 	/// <returns>Distance between two instances.</returns>
 	template <typename DistanceType = ValueType,
 		typename = std::enable_if_t< is_mathscalar_v<DistanceType> > >
-	DistanceType distance(BaseVector3<ValueType> const & other_) const
+	constexpr DistanceType distance(BaseVector3<ValueType> const & other_) const
 	{
 		return (*this - other_).template length<DistanceType>();
 	}
@@ -334,6 +348,15 @@ public:
 	/// <returns>Normalized vector</returns>
 	constexpr BaseVector3<ValueType> normalize() const
 	{
+	#if EDGE_SIMD_SSE
+		// SSE specialization of the float instantiation (see VectorSimd.hpp).
+		if constexpr(std::is_same_v<ValueType, float>)
+		{
+			BaseVector3<ValueType> result{ x, y, z };
+			Math::simd::normalize3(result.x, result.y, result.z);
+			return result;
+		}
+	#endif
 		auto len = this->length<ValueType>();
 		if (len != 0)
 		{
@@ -348,6 +371,14 @@ public:
 	/// <returns>Reference to normalized self.</returns>
 	constexpr BaseVector3<ValueType>& normalizeSelf()
 	{
+	#if EDGE_SIMD_SSE
+		// SSE specialization of the float instantiation (see VectorSimd.hpp).
+		if constexpr(std::is_same_v<ValueType, float>)
+		{
+			Math::simd::normalize3(x, y, z);
+			return *this;
+		}
+	#endif
 		auto len = this->length<ValueType>();
 		if (len != 0)
 		{
@@ -408,6 +439,73 @@ public:
 		return stream.str();
 	}
 
+	/// <summary>
+	/// Converts vector to characters in a caller-provided buffer - the allocation-free,
+	/// locale-independent counterpart of <see cref="toString"/>.
+	/// </summary>
+	/// <param name="buffer_">The output buffer.</param>
+	/// <param name="capacity_">The buffer capacity.</param>
+	/// <param name="setup_">The string building setup.</param>
+	/// <returns>Number of characters written (no terminator is appended), or 0 when the buffer is too small.</returns>
+	std::size_t toChars(char* buffer_, std::size_t capacity_, VectorStringBuilder const & setup_ = VectorStringBuilder{}) const
+	{
+		char* it = buffer_;
+		char* const last = buffer_ + capacity_;
+
+		switch (setup_.wrap)
+		{
+		case VectorStringBuilder::Wrap::Round:	{ it = detail::vectorWriteText(it, last, "( "); break; }
+		case VectorStringBuilder::Wrap::Square:	{ it = detail::vectorWriteText(it, last, "[ "); break; }
+		case VectorStringBuilder::Wrap::Curly:	{ it = detail::vectorWriteText(it, last, "{ "); break; }
+		default: break;
+		}
+
+		char const separator[2] = { static_cast<char>(setup_.separator), ' ' };
+		switch (setup_.compVisibility)
+		{
+		case VectorStringBuilder::CompVisibility::WithColon: {
+			it = detail::vectorWriteText(it, last, "x: ");
+			it = detail::vectorWriteScalar(it, last, x, setup_);
+			it = detail::vectorWriteText(it, last, { separator, 2 });
+			it = detail::vectorWriteText(it, last, "y: ");
+			it = detail::vectorWriteScalar(it, last, y, setup_);
+			it = detail::vectorWriteText(it, last, { separator, 2 });
+			it = detail::vectorWriteText(it, last, "z: ");
+			it = detail::vectorWriteScalar(it, last, z, setup_);
+			break;
+		}
+		case VectorStringBuilder::CompVisibility::WithEqual: {
+			it = detail::vectorWriteText(it, last, "x = ");
+			it = detail::vectorWriteScalar(it, last, x, setup_);
+			it = detail::vectorWriteText(it, last, { separator, 2 });
+			it = detail::vectorWriteText(it, last, "y = ");
+			it = detail::vectorWriteScalar(it, last, y, setup_);
+			it = detail::vectorWriteText(it, last, { separator, 2 });
+			it = detail::vectorWriteText(it, last, "z = ");
+			it = detail::vectorWriteScalar(it, last, z, setup_);
+			break;
+		}
+		default: {
+			it = detail::vectorWriteScalar(it, last, x, setup_);
+			it = detail::vectorWriteText(it, last, { separator, 2 });
+			it = detail::vectorWriteScalar(it, last, y, setup_);
+			it = detail::vectorWriteText(it, last, { separator, 2 });
+			it = detail::vectorWriteScalar(it, last, z, setup_);
+			break;
+		}
+		}
+
+		switch (setup_.wrap)
+		{
+		case VectorStringBuilder::Wrap::Round:	{ it = detail::vectorWriteText(it, last, " )"); break; }
+		case VectorStringBuilder::Wrap::Square:	{ it = detail::vectorWriteText(it, last, " ]"); break; }
+		case VectorStringBuilder::Wrap::Curly:	{ it = detail::vectorWriteText(it, last, " }"); break; }
+		default: break;
+		}
+
+		return it != nullptr ? static_cast<std::size_t>(it - buffer_) : 0;
+	}
+
 	/// <summary>
 	/// Checks if two vectors are equal.
 	/// </summary>
@@ -798,6 +896,12 @@ constexpr BaseVector3<VectorType> operator * (VectorType const lhs_, BaseVector3
 	};
 }
 
+// Explicit instantiation declarations for the most commonly used types.
+// Definitions live in src/EDGE/Core/Math/Vector3.cpp - other TUs don't re-instantiate them.
+extern template class BaseVector3<float>;
+extern template class BaseVector3<double>;
+extern template class BaseVector3<std::int32_t>;
+
 // 3D Vector class templated with float
 using Vector3f		= BaseVector3<float>;
 // 3D Vector class templated with float
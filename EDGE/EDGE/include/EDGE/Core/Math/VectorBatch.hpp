@@ -0,0 +1,706 @@
+// File description:
+// Implements structure-of-arrays companions for BaseVector2/BaseVector3
+// plus span-based batch kernels (SIMD accelerated for float).
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Compilation/Intrinsics.hpp>
+#include <EDGE/Core/Span.hpp>
+#include <EDGE/Core/Math/Vector2.hpp>
+#include <EDGE/Core/Math/Vector3.hpp>
+
+namespace edge
+{
+
+/// <summary>
+/// Structure-of-arrays storage for a sequence of 2D vectors.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Components are stored in separate contiguous arrays (x[], y[]) instead of
+///		interleaved BaseVector2 objects, so the batch kernels in <see cref="edge::batch"/>
+///		can stream whole cache lines of a single component through SIMD registers.
+/// </para>
+/// </remarks>
+template <typename VectorType>
+class BaseVector2Soa
+{
+public:
+	using ValueType		= VectorType;
+	using VectorValue	= BaseVector2<ValueType>;
+
+	static_assert(std::is_arithmetic_v<ValueType> && !std::is_same_v<ValueType, bool>,
+		"ValueType of a vector batch must be a non-cv qualified math scalar type.");
+
+	std::vector<ValueType> x, y;
+
+	/// <summary>
+	/// Returns number of vectors stored in the batch.
+	/// </summary>
+	/// <returns>Number of vectors stored in the batch.</returns>
+	std::size_t size() const {
+		return x.size();
+	}
+
+	/// <summary>
+	/// Determines whether the batch is empty.
+	/// </summary>
+	/// <returns>
+	///  <c>true</c> if batch is empty; otherwise, <c>false</c>.
+	/// </returns>
+	bool empty() const {
+		return x.empty();
+	}
+
+	/// <summary>
+	/// Reserves storage for specified number of vectors.
+	/// </summary>
+	/// <param name="count_">Number of vectors to reserve for.</param>
+	void reserve(std::size_t const count_) {
+		x.reserve(count_);
+		y.reserve(count_);
+	}
+
+	/// <summary>
+	/// Resizes the batch to specified number of vectors (new ones are zeroed).
+	/// </summary>
+	/// <param name="count_">New number of vectors.</param>
+	void resize(std::size_t const count_) {
+		x.resize(count_, ValueType{ 0 });
+		y.resize(count_, ValueType{ 0 });
+	}
+
+	/// <summary>
+	/// Removes every vector from the batch.
+	/// </summary>
+	void clear() {
+		x.clear();
+		y.clear();
+	}
+
+	/// <summary>
+	/// Appends vector at the end of the batch.
+	/// </summary>
+	/// <param name="vector_">The appended vector.</param>
+	void push(VectorValue const & vector_) {
+		x.push_back(vector_.x);
+		y.push_back(vector_.y);
+	}
+
+	/// <summary>
+	/// Returns vector with specified index by value.
+	/// </summary>
+	/// <param name="index_">The vector index.</param>
+	/// <returns>Vector with specified index by value.</returns>
+	VectorValue operator[](std::size_t const index_) const {
+		// # Assertion note:
+		// You tried to access vector beyond the batch size. Fix your code.
+		assert(index_ < this->size());
+		return VectorValue{ x[index_], y[index_] };
+	}
+
+	/// <summary>
+	/// Sets vector with specified index.
+	/// </summary>
+	/// <param name="index_">The vector index.</param>
+	/// <param name="vector_">The new value.</param>
+	void set(std::size_t const index_, VectorValue const & vector_) {
+		// # Assertion note:
+		// You tried to access vector beyond the batch size. Fix your code.
+		assert(index_ < this->size());
+		x[index_] = vector_.x;
+		y[index_] = vector_.y;
+	}
+};
+
+/// <summary>
+/// Structure-of-arrays storage for a sequence of 3D vectors.
+/// </summary>
+/// <remarks>
+/// <para>See <see cref="BaseVector2Soa"/> for rationale.</para>
+/// </remarks>
+template <typename VectorType>
+class BaseVector3Soa
+{
+public:
+	using ValueType		= VectorType;
+	using VectorValue	= BaseVector3<ValueType>;
+
+	static_assert(std::is_arithmetic_v<ValueType> && !std::is_same_v<ValueType, bool>,
+		"ValueType of a vector batch must be a non-cv qualified math scalar type.");
+
+	std::vector<ValueType> x, y, z;
+
+	/// <summary>
+	/// Returns number of vectors stored in the batch.
+	/// </summary>
+	/// <returns>Number of vectors stored in the batch.</returns>
+	std::size_t size() const {
+		return x.size();
+	}
+
+	/// <summary>
+	/// Determines whether the batch is empty.
+	/// </summary>
+	/// <returns>
+	///  <c>true</c> if batch is empty; otherwise, <c>false</c>.
+	/// </returns>
+	bool empty() const {
+		return x.empty();
+	}
+
+	/// <summary>
+	/// Reserves storage for specified number of vectors.
+	/// </summary>
+	/// <param name="count_">Number of vectors to reserve for.</param>
+	void reserve(std::size_t const count_) {
+		x.reserve(count_);
+		y.reserve(count_);
+		z.reserve(count_);
+	}
+
+	/// <summary>
+	/// Resizes the batch to specified number of vectors (new ones are zeroed).
+	/// </summary>
+	/// <param name="count_">New number of vectors.</param>
+	void resize(std::size_t const count_) {
+		x.resize(count_, ValueType{ 0 });
+		y.resize(count_, ValueType{ 0 });
+		z.resize(count_, ValueType{ 0 });
+	}
+
+	/// <summary>
+	/// Removes every vector from the batch.
+	/// </summary>
+	void clear() {
+		x.clear();
+		y.clear();
+		z.clear();
+	}
+
+	/// <summary>
+	/// Appends vector at the end of the batch.
+	/// </summary>
+	/// <param name="vector_">The appended vector.</param>
+	void push(VectorValue const & vector_) {
+		x.push_back(vector_.x);
+		y.push_back(vector_.y);
+		z.push_back(vector_.z);
+	}
+
+	/// <summary>
+	/// Returns vector with specified index by value.
+	/// </summary>
+	/// <param name="index_">The vector index.</param>
+	/// <returns>Vector with specified index by value.</returns>
+	VectorValue operator[](std::size_t const index_) const {
+		// # Assertion note:
+		// You tried to access vector beyond the batch size. Fix your code.
+		assert(index_ < this->size());
+		return VectorValue{ x[index_], y[index_], z[index_] };
+	}
+
+	/// <summary>
+	/// Sets vector with specified index.
+	/// </summary>
+	/// <param name="index_">The vector index.</param>
+	/// <param name="vector_">The new value.</param>
+	void set(std::size_t const index_, VectorValue const & vector_) {
+		// # Assertion note:
+		// You tried to access vector beyond the batch size. Fix your code.
+		assert(index_ < this->size());
+		x[index_] = vector_.x;
+		y[index_] = vector_.y;
+		z[index_] = vector_.z;
+	}
+};
+
+// 2D SoA vector batch templated with float
+using Vector2Soa	= BaseVector2Soa<float>;
+// 2D SoA vector batch templated with double
+using Vector2dSoa	= BaseVector2Soa<double>;
+// 3D SoA vector batch templated with float
+using Vector3Soa	= BaseVector3Soa<float>;
+// 3D SoA vector batch templated with double
+using Vector3dSoa	= BaseVector3Soa<double>;
+
+/// <summary>
+/// Batch kernels operating on whole component arrays at once.
+/// The float instantiations process four elements per iteration using SSE.
+/// </summary>
+namespace batch
+{
+
+namespace detail
+{
+
+// Computes out = a + b over `count_` elements.
+template <typename _type>
+inline void addKernel(_type const* a_, _type const* b_, _type* out_, std::size_t const count_)
+{
+	std::size_t i = 0;
+#if EDGE_SIMD_SSE
+	if constexpr (std::is_same_v<_type, float>)
+	{
+		for (; i + 4 <= count_; i += 4)
+			_mm_storeu_ps(out_ + i, _mm_add_ps(_mm_loadu_ps(a_ + i), _mm_loadu_ps(b_ + i)));
+	}
+#endif
+	for (; i < count_; ++i)
+		out_[i] = a_[i] + b_[i];
+}
+
+// Computes out = a * scalar over `count_` elements.
+template <typename _type>
+inline void scaleKernel(_type const* a_, _type const scalar_, _type* out_, std::size_t const count_)
+{
+	std::size_t i = 0;
+#if EDGE_SIMD_SSE
+	if constexpr (std::is_same_v<_type, float>)
+	{
+		__m128 const s = _mm_set1_ps(scalar_);
+		for (; i + 4 <= count_; i += 4)
+			_mm_storeu_ps(out_ + i, _mm_mul_ps(_mm_loadu_ps(a_ + i), s));
+	}
+#endif
+	for (; i < count_; ++i)
+		out_[i] = a_[i] * scalar_;
+}
+
+// Computes out = a + (b - a) * alpha over `count_` elements.
+template <typename _type>
+inline void lerpKernel(_type const* a_, _type const* b_, _type const alpha_, _type* out_, std::size_t const count_)
+{
+	std::size_t i = 0;
+#if EDGE_SIMD_SSE
+	if constexpr (std::is_same_v<_type, float>)
+	{
+		__m128 const t = _mm_set1_ps(alpha_);
+		for (; i + 4 <= count_; i += 4)
+		{
+			__m128 const a = _mm_loadu_ps(a_ + i);
+			__m128 const b = _mm_loadu_ps(b_ + i);
+			_mm_storeu_ps(out_ + i, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), t)));
+		}
+	}
+#endif
+	for (; i < count_; ++i)
+		out_[i] = a_[i] + (b_[i] - a_[i]) * alpha_;
+}
+
+} // namespace detail
+
+/// <summary>
+/// Adds component arrays together: out = a + b.
+/// </summary>
+/// <param name="a_">The lhs component array.</param>
+/// <param name="b_">The rhs component array.</param>
+/// <param name="out_">The output component array (may alias an input).</param>
+template <typename _type>
+inline void add(Span<_type const> a_, Span<_type const> b_, Span<_type> out_)
+{
+	// # Assertion note:
+	// Every span passed to a batch kernel must have the same size. Fix your code.
+	assert(a_.size() == b_.size() && a_.size() == out_.size());
+	detail::addKernel(a_.data(), b_.data(), out_.data(), out_.size());
+}
+
+/// <summary>
+/// Scales component array by a scalar: out = a * scalar.
+/// </summary>
+/// <param name="a_">The component array.</param>
+/// <param name="scalar_">The scalar.</param>
+/// <param name="out_">The output component array (may alias the input).</param>
+template <typename _type>
+inline void scale(Span<_type const> a_, _type const scalar_, Span<_type> out_)
+{
+	// # Assertion note:
+	// Every span passed to a batch kernel must have the same size. Fix your code.
+	assert(a_.size() == out_.size());
+	detail::scaleKernel(a_.data(), scalar_, out_.data(), out_.size());
+}
+
+/// <summary>
+/// Linearly interpolates component arrays: out = a + (b - a) * alpha.
+/// </summary>
+/// <param name="a_">The lhs component array.</param>
+/// <param name="b_">The rhs component array.</param>
+/// <param name="alpha_">The interpolation factor.</param>
+/// <param name="out_">The output component array (may alias an input).</param>
+template <typename _type>
+inline void lerp(Span<_type const> a_, Span<_type const> b_, _type const alpha_, Span<_type> out_)
+{
+	// # Assertion note:
+	// Every span passed to a batch kernel must have the same size. Fix your code.
+	assert(a_.size() == b_.size() && a_.size() == out_.size());
+	detail::lerpKernel(a_.data(), b_.data(), alpha_, out_.data(), out_.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Kernels over whole 2D batches.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// <summary>
+/// Adds two batches together: out = a + b.
+/// </summary>
+/// <param name="a_">The lhs batch.</param>
+/// <param name="b_">The rhs batch.</param>
+/// <param name="out_">The output batch (must be pre-sized, may alias an input).</param>
+template <typename _type>
+inline void add(BaseVector2Soa<_type> const & a_, BaseVector2Soa<_type> const & b_, BaseVector2Soa<_type> & out_)
+{
+	add<_type>(a_.x, b_.x, out_.x);
+	add<_type>(a_.y, b_.y, out_.y);
+}
+
+/// <summary>
+/// Scales whole batch by a scalar: out = a * scalar.
+/// </summary>
+/// <param name="a_">The batch.</param>
+/// <param name="scalar_">The scalar.</param>
+/// <param name="out_">The output batch (must be pre-sized, may alias the input).</param>
+template <typename _type>
+inline void scale(BaseVector2Soa<_type> const & a_, _type const scalar_, BaseVector2Soa<_type> & out_)
+{
+	scale<_type>(a_.x, scalar_, out_.x);
+	scale<_type>(a_.y, scalar_, out_.y);
+}
+
+/// <summary>
+/// Linearly interpolates two batches: out = a + (b - a) * alpha.
+/// </summary>
+/// <param name="a_">The lhs batch.</param>
+/// <param name="b_">The rhs batch.</param>
+/// <param name="alpha_">The interpolation factor.</param>
+/// <param name="out_">The output batch (must be pre-sized, may alias an input).</param>
+template <typename _type>
+inline void lerp(BaseVector2Soa<_type> const & a_, BaseVector2Soa<_type> const & b_, _type const alpha_, BaseVector2Soa<_type> & out_)
+{
+	lerp<_type>(a_.x, b_.x, alpha_, out_.x);
+	lerp<_type>(a_.y, b_.y, alpha_, out_.y);
+}
+
+/// <summary>
+/// Computes per-vector dot products of two batches.
+/// </summary>
+/// <param name="a_">The lhs batch.</param>
+/// <param name="b_">The rhs batch.</param>
+/// <param name="out_">The output scalar array.</param>
+template <typename _type>
+inline void dot(BaseVector2Soa<_type> const & a_, BaseVector2Soa<_type> const & b_, Span<_type> out_)
+{
+	// # Assertion note:
+	// Every batch passed to a batch kernel must have the same size. Fix your code.
+	assert(a_.size() == b_.size() && a_.size() == out_.size());
+
+	std::size_t const count	= out_.size();
+	_type const* ax			= a_.x.data();
+	_type const* ay			= a_.y.data();
+	_type const* bx			= b_.x.data();
+	_type const* by			= b_.y.data();
+
+	std::size_t i = 0;
+#if EDGE_SIMD_SSE
+	if constexpr (std::is_same_v<_type, float>)
+	{
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 const xs = _mm_mul_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i));
+			__m128 const ys = _mm_mul_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i));
+			_mm_storeu_ps(out_.data() + i, _mm_add_ps(xs, ys));
+		}
+	}
+#endif
+	for (; i < count; ++i)
+		out_[i] = ax[i] * bx[i] + ay[i] * by[i];
+}
+
+/// <summary>
+/// Computes per-vector lengths of a batch.
+/// </summary>
+/// <param name="a_">The batch.</param>
+/// <param name="out_">The output scalar array.</param>
+template <typename _type>
+inline void length(BaseVector2Soa<_type> const & a_, Span<_type> out_)
+{
+	static_assert(std::is_floating_point_v<_type>, "Batch length requires a floating point type.");
+
+	// # Assertion note:
+	// Every batch passed to a batch kernel must have the same size. Fix your code.
+	assert(a_.size() == out_.size());
+
+	std::size_t const count	= out_.size();
+	_type const* ax			= a_.x.data();
+	_type const* ay			= a_.y.data();
+
+	std::size_t i = 0;
+#if EDGE_SIMD_SSE
+	if constexpr (std::is_same_v<_type, float>)
+	{
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 const xs = _mm_loadu_ps(ax + i);
+			__m128 const ys = _mm_loadu_ps(ay + i);
+			__m128 const sq = _mm_add_ps(_mm_mul_ps(xs, xs), _mm_mul_ps(ys, ys));
+			_mm_storeu_ps(out_.data() + i, _mm_sqrt_ps(sq));
+		}
+	}
+#endif
+	for (; i < count; ++i)
+		out_[i] = std::sqrt(ax[i] * ax[i] + ay[i] * ay[i]);
+}
+
+/// <summary>
+/// Normalizes every vector of a batch. Zero-length vectors are left unchanged,
+/// matching the behaviour of <see cref="BaseVector2::normalize"/>.
+/// </summary>
+/// <param name="a_">The batch.</param>
+/// <param name="out_">The output batch (must be pre-sized, may alias the input).</param>
+template <typename _type>
+inline void normalize(BaseVector2Soa<_type> const & a_, BaseVector2Soa<_type> & out_)
+{
+	static_assert(std::is_floating_point_v<_type>, "Batch normalize requires a floating point type.");
+
+	// # Assertion note:
+	// Every batch passed to a batch kernel must have the same size. Fix your code.
+	assert(a_.size() == out_.size());
+
+	std::size_t const count	= a_.size();
+	_type const* ax			= a_.x.data();
+	_type const* ay			= a_.y.data();
+	_type* ox				= out_.x.data();
+	_type* oy				= out_.y.data();
+
+	std::size_t i = 0;
+#if EDGE_SIMD_SSE
+	if constexpr (std::is_same_v<_type, float>)
+	{
+		__m128 const zero = _mm_setzero_ps();
+		__m128 const one = _mm_set1_ps(1.f);
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 const xs		= _mm_loadu_ps(ax + i);
+			__m128 const ys		= _mm_loadu_ps(ay + i);
+			__m128 const sq		= _mm_add_ps(_mm_mul_ps(xs, xs), _mm_mul_ps(ys, ys));
+			// Zero-length lanes produce inf here; they get masked out below.
+			__m128 const inv	= _mm_div_ps(one, _mm_sqrt_ps(sq));
+			__m128 const mask	= _mm_cmpneq_ps(sq, zero);
+			__m128 const nx		= _mm_mul_ps(xs, inv);
+			__m128 const ny		= _mm_mul_ps(ys, inv);
+			_mm_storeu_ps(ox + i, _mm_or_ps(_mm_and_ps(mask, nx), _mm_andnot_ps(mask, xs)));
+			_mm_storeu_ps(oy + i, _mm_or_ps(_mm_and_ps(mask, ny), _mm_andnot_ps(mask, ys)));
+		}
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		_type const sq = ax[i] * ax[i] + ay[i] * ay[i];
+		if (sq != _type{ 0 })
+		{
+			_type const inv = _type{ 1 } / std::sqrt(sq);
+			ox[i] = ax[i] * inv;
+			oy[i] = ay[i] * inv;
+		}
+		else
+		{
+			ox[i] = ax[i];
+			oy[i] = ay[i];
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Kernels over whole 3D batches.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// <summary>
+/// Adds two batches together: out = a + b.
+/// </summary>
+/// <param name="a_">The lhs batch.</param>
+/// <param name="b_">The rhs batch.</param>
+/// <param name="out_">The output batch (must be pre-sized, may alias an input).</param>
+template <typename _type>
+inline void add(BaseVector3Soa<_type> const & a_, BaseVector3Soa<_type> const & b_, BaseVector3Soa<_type> & out_)
+{
+	add<_type>(a_.x, b_.x, out_.x);
+	add<_type>(a_.y, b_.y, out_.y);
+	add<_type>(a_.z, b_.z, out_.z);
+}
+
+/// <summary>
+/// Scales whole batch by a scalar: out = a * scalar.
+/// </summary>
+/// <param name="a_">The batch.</param>
+/// <param name="scalar_">The scalar.</param>
+/// <param name="out_">The output batch (must be pre-sized, may alias the input).</param>
+template <typename _type>
+inline void scale(BaseVector3Soa<_type> const & a_, _type const scalar_, BaseVector3Soa<_type> & out_)
+{
+	scale<_type>(a_.x, scalar_, out_.x);
+	scale<_type>(a_.y, scalar_, out_.y);
+	scale<_type>(a_.z, scalar_, out_.z);
+}
+
+/// <summary>
+/// Linearly interpolates two batches: out = a + (b - a) * alpha.
+/// </summary>
+/// <param name="a_">The lhs batch.</param>
+/// <param name="b_">The rhs batch.</param>
+/// <param name="alpha_">The interpolation factor.</param>
+/// <param name="out_">The output batch (must be pre-sized, may alias an input).</param>
+template <typename _type>
+inline void lerp(BaseVector3Soa<_type> const & a_, BaseVector3Soa<_type> const & b_, _type const alpha_, BaseVector3Soa<_type> & out_)
+{
+	lerp<_type>(a_.x, b_.x, alpha_, out_.x);
+	lerp<_type>(a_.y, b_.y, alpha_, out_.y);
+	lerp<_type>(a_.z, b_.z, alpha_, out_.z);
+}
+
+/// <summary>
+/// Computes per-vector dot products of two batches.
+/// </summary>
+/// <param name="a_">The lhs batch.</param>
+/// <param name="b_">The rhs batch.</param>
+/// <param name="out_">The output scalar array.</param>
+template <typename _type>
+inline void dot(BaseVector3Soa<_type> const & a_, BaseVector3Soa<_type> const & b_, Span<_type> out_)
+{
+	// # Assertion note:
+	// Every batch passed to a batch kernel must have the same size. Fix your code.
+	assert(a_.size() == b_.size() && a_.size() == out_.size());
+
+	std::size_t const count	= out_.size();
+	_type const* ax			= a_.x.data();
+	_type const* ay			= a_.y.data();
+	_type const* az			= a_.z.data();
+	_type const* bx			= b_.x.data();
+	_type const* by			= b_.y.data();
+	_type const* bz			= b_.z.data();
+
+	std::size_t i = 0;
+#if EDGE_SIMD_SSE
+	if constexpr (std::is_same_v<_type, float>)
+	{
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 const xs = _mm_mul_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i));
+			__m128 const ys = _mm_mul_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i));
+			__m128 const zs = _mm_mul_ps(_mm_loadu_ps(az + i), _mm_loadu_ps(bz + i));
+			_mm_storeu_ps(out_.data() + i, _mm_add_ps(_mm_add_ps(xs, ys), zs));
+		}
+	}
+#endif
+	for (; i < count; ++i)
+		out_[i] = ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i];
+}
+
+/// <summary>
+/// Computes per-vector lengths of a batch.
+/// </summary>
+/// <param name="a_">The batch.</param>
+/// <param name="out_">The output scalar array.</param>
+template <typename _type>
+inline void length(BaseVector3Soa<_type> const & a_, Span<_type> out_)
+{
+	static_assert(std::is_floating_point_v<_type>, "Batch length requires a floating point type.");
+
+	// # Assertion note:
+	// Every batch passed to a batch kernel must have the same size. Fix your code.
+	assert(a_.size() == out_.size());
+
+	std::size_t const count	= out_.size();
+	_type const* ax			= a_.x.data();
+	_type const* ay			= a_.y.data();
+	_type const* az			= a_.z.data();
+
+	std::size_t i = 0;
+#if EDGE_SIMD_SSE
+	if constexpr (std::is_same_v<_type, float>)
+	{
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 const xs = _mm_loadu_ps(ax + i);
+			__m128 const ys = _mm_loadu_ps(ay + i);
+			__m128 const zs = _mm_loadu_ps(az + i);
+			__m128 const sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, xs), _mm_mul_ps(ys, ys)), _mm_mul_ps(zs, zs));
+			_mm_storeu_ps(out_.data() + i, _mm_sqrt_ps(sq));
+		}
+	}
+#endif
+	for (; i < count; ++i)
+		out_[i] = std::sqrt(ax[i] * ax[i] + ay[i] * ay[i] + az[i] * az[i]);
+}
+
+/// <summary>
+/// Normalizes every vector of a batch. Zero-length vectors are left unchanged,
+/// matching the behaviour of <see cref="BaseVector3::normalize"/>.
+/// </summary>
+/// <param name="a_">The batch.</param>
+/// <param name="out_">The output batch (must be pre-sized, may alias the input).</param>
+template <typename _type>
+inline void normalize(BaseVector3Soa<_type> const & a_, BaseVector3Soa<_type> & out_)
+{
+	static_assert(std::is_floating_point_v<_type>, "Batch normalize requires a floating point type.");
+
+	// # Assertion note:
+	// Every batch passed to a batch kernel must have the same size. Fix your code.
+	assert(a_.size() == out_.size());
+
+	std::size_t const count	= a_.size();
+	_type const* ax			= a_.x.data();
+	_type const* ay			= a_.y.data();
+	_type const* az			= a_.z.data();
+	_type* ox				= out_.x.data();
+	_type* oy				= out_.y.data();
+	_type* oz				= out_.z.data();
+
+	std::size_t i = 0;
+#if EDGE_SIMD_SSE
+	if constexpr (std::is_same_v<_type, float>)
+	{
+		__m128 const zero = _mm_setzero_ps();
+		__m128 const one = _mm_set1_ps(1.f);
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 const xs		= _mm_loadu_ps(ax + i);
+			__m128 const ys		= _mm_loadu_ps(ay + i);
+			__m128 const zs		= _mm_loadu_ps(az + i);
+			__m128 const sq		= _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, xs), _mm_mul_ps(ys, ys)), _mm_mul_ps(zs, zs));
+			// Zero-length lanes produce inf here; they get masked out below.
+			__m128 const inv	= _mm_div_ps(one, _mm_sqrt_ps(sq));
+			__m128 const mask	= _mm_cmpneq_ps(sq, zero);
+			__m128 const nx		= _mm_mul_ps(xs, inv);
+			__m128 const ny		= _mm_mul_ps(ys, inv);
+			__m128 const nz		= _mm_mul_ps(zs, inv);
+			_mm_storeu_ps(ox + i, _mm_or_ps(_mm_and_ps(mask, nx), _mm_andnot_ps(mask, xs)));
+			_mm_storeu_ps(oy + i, _mm_or_ps(_mm_and_ps(mask, ny), _mm_andnot_ps(mask, ys)));
+			_mm_storeu_ps(oz + i, _mm_or_ps(_mm_and_ps(mask, nz), _mm_andnot_ps(mask, zs)));
+		}
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		_type const sq = ax[i] * ax[i] + ay[i] * ay[i] + az[i] * az[i];
+		if (sq != _type{ 0 })
+		{
+			_type const inv = _type{ 1 } / std::sqrt(sq);
+			ox[i] = ax[i] * inv;
+			oy[i] = ay[i] * inv;
+			oz[i] = az[i] * inv;
+		}
+		else
+		{
+			ox[i] = ax[i];
+			oy[i] = ay[i];
+			oz[i] = az[i];
+		}
+	}
+}
+
+} // namespace batch
+
+} // namespace edge
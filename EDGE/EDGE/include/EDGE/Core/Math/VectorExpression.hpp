@@ -0,0 +1,268 @@
+// File description:
+// Implements expression templates that fuse chained BaseVector2 arithmetic
+// into a single component-wise pass at assignment.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/Math/Vector2.hpp>
+
+namespace edge
+{
+
+// Usage:
+//		Vector2 position = fuse(a) + b * dt + gravity * (dt * dt);
+//
+// `fuse()` wraps a vector into a lightweight expression node; every operator
+// applied to an expression builds a bigger expression instead of materializing
+// a temporary BaseVector2. The whole chain evaluates component-by-component
+// exactly once, when the expression converts back to a BaseVector2.
+//
+// Plain vector <op> vector (without `fuse`) keeps its eager, value-returning
+// behaviour, so existing call sites are unaffected.
+//
+// # Lifetime note:
+// Expression nodes reference their operands - evaluate them within the same
+// full-expression. Do not store an expression in a variable (use `auto v = Vector2{ ... }`).
+
+namespace expr
+{
+
+template <typename VectorType>
+class Vec2Ref;
+template <typename VectorType>
+class Vec2Scalar;
+template <typename _op, typename _lhs, typename _rhs>
+class Vec2Binary;
+
+// Trait: is the type one of the expression node templates above?
+template <typename _type>
+struct IsVec2Expression
+	: std::false_type {};
+template <typename VectorType>
+struct IsVec2Expression< Vec2Ref<VectorType> >
+	: std::true_type {};
+template <typename VectorType>
+struct IsVec2Expression< Vec2Scalar<VectorType> >
+	: std::true_type {};
+template <typename _op, typename _lhs, typename _rhs>
+struct IsVec2Expression< Vec2Binary<_op, _lhs, _rhs> >
+	: std::true_type {};
+
+template <typename _type>
+constexpr bool isVec2Expression_v = IsVec2Expression< remove_cvref_t<_type> >::value;
+
+// Trait: is the type a BaseVector2 instantiation?
+template <typename _type>
+struct IsBaseVector2
+	: std::false_type {};
+template <typename VectorType>
+struct IsBaseVector2< BaseVector2<VectorType> >
+	: std::true_type {};
+
+template <typename _type>
+constexpr bool isBaseVector2_v = IsBaseVector2< remove_cvref_t<_type> >::value;
+
+// Trait: can the type appear as an operand of a fused expression?
+template <typename _type>
+constexpr bool isVec2Operand_v =
+	isVec2Expression_v<_type>					||
+	isBaseVector2_v<_type>						||
+	std::is_arithmetic_v< remove_cvref_t<_type> >;
+
+/// <summary>
+/// Terminal expression node referencing an existing vector.
+/// </summary>
+template <typename VectorType>
+class Vec2Ref
+{
+public:
+	using ValueType = VectorType;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Vec2Ref"/> class.
+	/// </summary>
+	/// <param name="vector_">The referenced vector.</param>
+	constexpr Vec2Ref(BaseVector2<ValueType> const & vector_)
+		: m_vector{ vector_ }
+	{
+	}
+
+	// Component accessors (evaluated lazily by the expression root):
+	constexpr ValueType x() const { return m_vector.x; }
+	constexpr ValueType y() const { return m_vector.y; }
+
+	/// <summary>
+	/// Evaluates the expression into a plain vector.
+	/// </summary>
+	/// <returns>Evaluated vector.</returns>
+	constexpr operator BaseVector2<ValueType>() const {
+		return BaseVector2<ValueType>{ this->x(), this->y() };
+	}
+
+private:
+	BaseVector2<ValueType> const & m_vector;
+};
+
+/// <summary>
+/// Terminal expression node broadcasting a scalar to both components.
+/// </summary>
+template <typename VectorType>
+class Vec2Scalar
+{
+public:
+	using ValueType = VectorType;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Vec2Scalar"/> class.
+	/// </summary>
+	/// <param name="value_">The broadcast scalar.</param>
+	constexpr Vec2Scalar(ValueType const value_)
+		: m_value{ value_ }
+	{
+	}
+
+	// Component accessors (evaluated lazily by the expression root):
+	constexpr ValueType x() const { return m_value; }
+	constexpr ValueType y() const { return m_value; }
+
+private:
+	ValueType m_value;
+};
+
+// Component-wise operations applied by Vec2Binary:
+struct OpAdd {
+	template <typename _type>
+	constexpr static _type apply(_type const lhs_, _type const rhs_) { return lhs_ + rhs_; }
+};
+struct OpSubtract {
+	template <typename _type>
+	constexpr static _type apply(_type const lhs_, _type const rhs_) { return lhs_ - rhs_; }
+};
+struct OpMultiply {
+	template <typename _type>
+	constexpr static _type apply(_type const lhs_, _type const rhs_) { return lhs_ * rhs_; }
+};
+struct OpDivide {
+	template <typename _type>
+	constexpr static _type apply(_type const lhs_, _type const rhs_) { return lhs_ / rhs_; }
+};
+
+/// <summary>
+/// Expression node combining two subexpressions with a component-wise operation.
+/// </summary>
+template <typename _op, typename _lhs, typename _rhs>
+class Vec2Binary
+{
+public:
+	using ValueType = typename _lhs::ValueType;
+
+	static_assert(std::is_same_v<ValueType, typename _rhs::ValueType>,
+		"Both sides of a fused vector expression must share the same ValueType.");
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Vec2Binary"/> class.
+	/// </summary>
+	/// <param name="lhs_">The lhs subexpression.</param>
+	/// <param name="rhs_">The rhs subexpression.</param>
+	constexpr Vec2Binary(_lhs const lhs_, _rhs const rhs_)
+		: m_lhs{ lhs_ }, m_rhs{ rhs_ }
+	{
+	}
+
+	// Component accessors (evaluated lazily by the expression root):
+	constexpr ValueType x() const { return _op::apply(m_lhs.x(), m_rhs.x()); }
+	constexpr ValueType y() const { return _op::apply(m_lhs.y(), m_rhs.y()); }
+
+	/// <summary>
+	/// Evaluates the expression into a plain vector.
+	/// </summary>
+	/// <returns>Evaluated vector.</returns>
+	constexpr operator BaseVector2<ValueType>() const {
+		return BaseVector2<ValueType>{ this->x(), this->y() };
+	}
+
+private:
+	_lhs m_lhs;
+	_rhs m_rhs;
+};
+
+// Wraps an operand into an expression node (expressions pass through unchanged).
+template <typename _expr,
+	typename = std::enable_if_t< isVec2Expression_v<_expr> > >
+constexpr _expr makeOperand(_expr const & expression_) {
+	return expression_;
+}
+template <typename VectorType>
+constexpr Vec2Ref<VectorType> makeOperand(BaseVector2<VectorType> const & vector_) {
+	return Vec2Ref<VectorType>{ vector_ };
+}
+template <typename _scalar,
+	typename = std::enable_if_t< std::is_arithmetic_v<_scalar> >,
+	typename = void >
+constexpr Vec2Scalar<_scalar> makeOperand(_scalar const scalar_) {
+	return Vec2Scalar<_scalar>{ scalar_ };
+}
+
+// Builds a binary node out of two (wrapped) operands.
+template <typename _op, typename _lhs, typename _rhs>
+constexpr auto makeBinary(_lhs const & lhs_, _rhs const & rhs_)
+{
+	return Vec2Binary<_op,
+			decltype( makeOperand(lhs_) ),
+			decltype( makeOperand(rhs_) )
+		>{ makeOperand(lhs_), makeOperand(rhs_) };
+}
+
+// Operand pair is fusable when both sides are valid operands and at least
+// one of them already is an expression node (this keeps the eager
+// BaseVector2 operators in Vector2.hpp authoritative for plain vectors).
+template <typename _lhs, typename _rhs>
+constexpr bool isFusablePair_v =
+	isVec2Operand_v<_lhs> && isVec2Operand_v<_rhs> &&
+	(isVec2Expression_v<_lhs> || isVec2Expression_v<_rhs>);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Operators building fused expressions (found via ADL on the node types).
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename _lhs, typename _rhs,
+	typename = std::enable_if_t< isFusablePair_v<_lhs, _rhs> > >
+constexpr auto operator + (_lhs const & lhs_, _rhs const & rhs_) {
+	return makeBinary<OpAdd>(lhs_, rhs_);
+}
+
+template <typename _lhs, typename _rhs,
+	typename = std::enable_if_t< isFusablePair_v<_lhs, _rhs> > >
+constexpr auto operator - (_lhs const & lhs_, _rhs const & rhs_) {
+	return makeBinary<OpSubtract>(lhs_, rhs_);
+}
+
+template <typename _lhs, typename _rhs,
+	typename = std::enable_if_t< isFusablePair_v<_lhs, _rhs> > >
+constexpr auto operator * (_lhs const & lhs_, _rhs const & rhs_) {
+	return makeBinary<OpMultiply>(lhs_, rhs_);
+}
+
+template <typename _lhs, typename _rhs,
+	typename = std::enable_if_t< isFusablePair_v<_lhs, _rhs> > >
+constexpr auto operator / (_lhs const & lhs_, _rhs const & rhs_) {
+	return makeBinary<OpDivide>(lhs_, rhs_);
+}
+
+} // namespace expr
+
+/// <summary>
+/// Starts a fused expression chain (see the usage note at the top of this file).
+/// </summary>
+/// <param name="vector_">The vector to wrap.</param>
+/// <returns>Expression node referencing the vector.</returns>
+template <typename VectorType>
+constexpr expr::Vec2Ref<VectorType> fuse(BaseVector2<VectorType> const & vector_) {
+	return expr::Vec2Ref<VectorType>{ vector_ };
+}
+
+} // namespace edge
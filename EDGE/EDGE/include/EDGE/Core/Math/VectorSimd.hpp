@@ -0,0 +1,109 @@
+// File description:
+// Implements SSE specializations of the per-vector hot operations.
+// Used by the float instantiations of BaseVector2/BaseVector3 behind their existing API.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Compilation/Intrinsics.hpp>
+
+namespace edge
+{
+
+namespace Math
+{
+
+namespace simd
+{
+
+// Whether the SIMD specializations below are compiled in.
+constexpr bool available = (EDGE_SIMD_SSE != 0);
+
+#if EDGE_SIMD_SSE
+
+/// <summary>
+/// Computes 1 / sqrt(value) using `rsqrtss` refined by one Newton-Raphson step (~22 bit accuracy).
+/// </summary>
+/// <param name="value_">The value (must be &gt; 0).</param>
+/// <returns>Approximate reciprocal square root of the value.</returns>
+inline float invSqrt(float const value_)
+{
+	__m128 const v				= _mm_set_ss(value_);
+	__m128 const half			= _mm_set_ss(0.5f);
+	__m128 const threeHalves	= _mm_set_ss(1.5f);
+
+	__m128 est = _mm_rsqrt_ss(v);
+	// Newton-Raphson refinement: est = est * (1.5 - 0.5 * v * est * est)
+	est = _mm_mul_ss(est, _mm_sub_ss(threeHalves, _mm_mul_ss(_mm_mul_ss(_mm_mul_ss(half, v), est), est)));
+	return _mm_cvtss_f32(est);
+}
+
+/// <summary>
+/// Computes length of a 2D vector using the scalar SSE sqrt (no libm call).
+/// </summary>
+/// <param name="x_">The x component.</param>
+/// <param name="y_">The y component.</param>
+/// <returns>Length of the vector.</returns>
+inline float length2(float const x_, float const y_)
+{
+	return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(x_ * x_ + y_ * y_)));
+}
+
+/// <summary>
+/// Computes length of a 3D vector using the scalar SSE sqrt (no libm call).
+/// </summary>
+/// <param name="x_">The x component.</param>
+/// <param name="y_">The y component.</param>
+/// <param name="z_">The z component.</param>
+/// <returns>Length of the vector.</returns>
+inline float length3(float const x_, float const y_, float const z_)
+{
+	return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(x_ * x_ + y_ * y_ + z_ * z_)));
+}
+
+/// <summary>
+/// Normalizes a 2D vector in place via reciprocal square root.
+/// Zero-length vectors are left unchanged.
+/// </summary>
+/// <param name="x_">[in/out] The x component.</param>
+/// <param name="y_">[in/out] The y component.</param>
+inline void normalize2(float & x_, float & y_)
+{
+	float const lengthSq = x_ * x_ + y_ * y_;
+	if (lengthSq != 0.f)
+	{
+		float const inv = invSqrt(lengthSq);
+		x_ *= inv;
+		y_ *= inv;
+	}
+}
+
+/// <summary>
+/// Normalizes a 3D vector in place via reciprocal square root.
+/// Zero-length vectors are left unchanged.
+/// </summary>
+/// <param name="x_">[in/out] The x component.</param>
+/// <param name="y_">[in/out] The y component.</param>
+/// <param name="z_">[in/out] The z component.</param>
+inline void normalize3(float & x_, float & y_, float & z_)
+{
+	float const lengthSq = x_ * x_ + y_ * y_ + z_ * z_;
+	if (lengthSq != 0.f)
+	{
+		float const inv = invSqrt(lengthSq);
+		x_ *= inv;
+		y_ *= inv;
+		z_ *= inv;
+	}
+}
+
+#endif // EDGE_SIMD_SSE
+
+} // namespace simd
+
+} // namespace Math
+
+} // namespace edge
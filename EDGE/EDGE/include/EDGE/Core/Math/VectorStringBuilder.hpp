@@ -69,4 +69,230 @@ struct EDGE_API VectorStringBuilder final
 	};
 };
 
+namespace detail
+{
+
+/// <summary>
+/// Appends text to a toChars buffer. Returns the advanced iterator, or null when the
+/// buffer is exhausted; a null iterator (earlier failure) stays null.
+/// </summary>
+inline char* vectorWriteText(char* it_, char* const last_, std::string_view const text_)
+{
+	if (it_ == nullptr || static_cast<std::size_t>(last_ - it_) < text_.size())
+		return nullptr;
+	std::memcpy(it_, text_.data(), text_.size());
+	return it_ + text_.size();
+}
+
+/// <summary>
+/// Appends an unsigned integer, left-padded with zeros to at least `minDigits_` digits.
+/// </summary>
+inline char* vectorWriteUnsigned(char* it_, char* const last_, unsigned long long const value_, int const minDigits_)
+{
+	char temp[24];
+	auto const result = std::to_chars(temp, temp + sizeof(temp), value_);
+	for (int i = static_cast<int>(result.ptr - temp); i < minDigits_ && it_ != nullptr; i++)
+		it_ = vectorWriteText(it_, last_, "0");
+	return vectorWriteText(it_, last_, { temp, static_cast<std::size_t>(result.ptr - temp) });
+}
+
+/// <summary>
+/// Appends a floating point value in fixed notation with `precision_` fraction digits.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Our toolset ships std::to_chars for integers only, so the digits are produced
+///		manually: whole and fraction parts become two integer conversions. Matches the
+///		iostream std::fixed output for typical snapshot magnitudes; for values whose
+///		ulp exceeds 1 the fraction is zero and last-digit rounding is approximate.
+/// </para>
+/// </remarks>
+inline char* vectorWriteFixedFloat(char* it_, char* const last_, double const value_, int const precision_)
+{
+	if (it_ == nullptr)
+		return nullptr;
+	if (std::isnan(value_))
+		return vectorWriteText(it_, last_, "nan");
+	if (std::isinf(value_))
+		return vectorWriteText(it_, last_, std::signbit(value_) ? "-inf" : "inf");
+
+	if (std::signbit(value_))
+		it_ = vectorWriteText(it_, last_, "-");
+
+	double const absValue = std::fabs(value_);
+
+	// A double carries at most 17 significant decimals - longer precisions are zero-padded.
+	int const fracDigits = std::min(precision_, 17);
+	double scale = 1;
+	for (int i = 0; i < fracDigits; i++)
+		scale *= 10;
+
+	if (absValue < 9.2e18) // whole part fits unsigned long long
+	{
+		auto const scaleInt = static_cast<unsigned long long>(scale);
+		unsigned long long units, frac;
+		if (absValue * scale < 9.2e18)
+		{
+			// Round units and fraction as one scaled integer - nearbyint, not +0.5,
+			// so exact halves round to even like the iostream digits do.
+			auto const total = static_cast<unsigned long long>(std::nearbyint(absValue * scale));
+			units	= total / scaleInt;
+			frac	= total % scaleInt;
+		}
+		else
+		{
+			// Scaled value no longer fits 64 bits - split first (ties cannot occur
+			// here, the ulp already exceeds the rounding step).
+			units	= static_cast<unsigned long long>(absValue);
+			frac	= static_cast<unsigned long long>(std::nearbyint((absValue - static_cast<double>(units)) * scale));
+			if (frac >= scaleInt)
+			{
+				units++;
+				frac -= scaleInt;
+			}
+		}
+		it_ = vectorWriteUnsigned(it_, last_, units, 1);
+		if (precision_ > 0)
+		{
+			it_ = vectorWriteText(it_, last_, ".");
+			it_ = vectorWriteUnsigned(it_, last_, frac, fracDigits);
+			for (int i = fracDigits; i < precision_ && it_ != nullptr; i++)
+				it_ = vectorWriteText(it_, last_, "0");
+		}
+		return it_;
+	}
+
+	// Whole part beyond 64 bits - its ulp also exceeds 1, so every fraction digit is
+	// zero; emit the integer digits through repeated division.
+	int const wholeDigits = static_cast<int>(std::floor(std::log10(absValue))) + 1;
+	double digitScale = std::pow(10.0, wholeDigits - 1);
+	for (int i = 0; i < wholeDigits && it_ != nullptr; i++)
+	{
+		auto const digit = std::min(9, static_cast<int>(std::fmod(std::floor(absValue / digitScale), 10.0)));
+		char const character = static_cast<char>('0' + digit);
+		it_ = vectorWriteText(it_, last_, { &character, 1 });
+		digitScale /= 10;
+	}
+	if (precision_ > 0)
+	{
+		it_ = vectorWriteText(it_, last_, ".");
+		for (int i = 0; i < precision_ && it_ != nullptr; i++)
+			it_ = vectorWriteText(it_, last_, "0");
+	}
+	return it_;
+}
+
+/// <summary>
+/// Appends a floating point value in general notation with `precision_` significant
+/// digits - the same %g-style rules std::ostream applies without std::fixed
+/// (scientific form when the exponent is below -4 or at least the precision,
+/// trailing zeros trimmed).
+/// </summary>
+inline char* vectorWriteGeneralFloat(char* it_, char* const last_, double const value_, int precision_)
+{
+	if (it_ == nullptr)
+		return nullptr;
+	if (std::isnan(value_))
+		return vectorWriteText(it_, last_, "nan");
+	if (std::isinf(value_))
+		return vectorWriteText(it_, last_, std::signbit(value_) ? "-inf" : "inf");
+	if (value_ == 0)
+		return vectorWriteText(it_, last_, std::signbit(value_) ? "-0" : "0");
+
+	precision_ = std::min(std::max(precision_, 1), 17);
+
+	if (std::signbit(value_))
+		it_ = vectorWriteText(it_, last_, "-");
+
+	double const absValue = std::fabs(value_);
+
+	// Decimal exponent and normalized mantissa in [1, 10).
+	int exponent = static_cast<int>(std::floor(std::log10(absValue)));
+	double mantissa = absValue / std::pow(10.0, exponent);
+	if (mantissa >= 10.0)	{ mantissa /= 10; exponent++; }
+	else if (mantissa < 1.0){ mantissa *= 10; exponent--; }
+
+	// All significant digits as one integer. Where the power of ten is exactly
+	// representable (|shift| <= 22) scale the value directly - the normalized
+	// mantissa costs one extra rounding that can flip the last digit on ties.
+	unsigned long long scale = 1;
+	for (int i = 1; i < precision_; i++)
+		scale *= 10;
+	int const shift = precision_ - 1 - exponent;
+	double scaled;
+	if (shift >= 0 && shift <= 22)
+		scaled = absValue * std::pow(10.0, shift);
+	else if (shift < 0 && shift >= -22)
+		scaled = absValue / std::pow(10.0, -shift);
+	else
+		scaled = mantissa * static_cast<double>(scale);
+	// nearbyint, not +0.5: exact halves round to even, matching the iostream digits.
+	auto digits = static_cast<unsigned long long>(std::nearbyint(scaled));
+	while (digits >= scale * 10)	{ digits /= 10; exponent++; }
+	while (digits < scale && precision_ > 1) { digits *= 10; exponent--; }
+
+	char temp[24];
+	auto const tempEnd = std::to_chars(temp, temp + sizeof(temp), digits).ptr;
+	int digitCount = static_cast<int>(tempEnd - temp);
+	while (digitCount > 1 && temp[digitCount - 1] == '0')
+		digitCount--; // trim trailing zeros
+
+	if (exponent < -4 || exponent >= precision_)
+	{
+		// Scientific: d.ddde±XX (two exponent digits minimum, like the iostream path).
+		it_ = vectorWriteText(it_, last_, { temp, 1 });
+		if (digitCount > 1)
+		{
+			it_ = vectorWriteText(it_, last_, ".");
+			it_ = vectorWriteText(it_, last_, { temp + 1, static_cast<std::size_t>(digitCount - 1) });
+		}
+		it_ = vectorWriteText(it_, last_, exponent < 0 ? "e-" : "e+");
+		return vectorWriteUnsigned(it_, last_, static_cast<unsigned long long>(exponent < 0 ? -exponent : exponent), 2);
+	}
+	if (exponent >= 0)
+	{
+		int const wholeCount = exponent + 1;
+		if (digitCount <= wholeCount)
+		{
+			// Pure integer, possibly zero-extended (e.g. 1200 with 2 significant digits).
+			it_ = vectorWriteText(it_, last_, { temp, static_cast<std::size_t>(digitCount) });
+			for (int i = digitCount; i < wholeCount && it_ != nullptr; i++)
+				it_ = vectorWriteText(it_, last_, "0");
+			return it_;
+		}
+		it_ = vectorWriteText(it_, last_, { temp, static_cast<std::size_t>(wholeCount) });
+		it_ = vectorWriteText(it_, last_, ".");
+		return vectorWriteText(it_, last_, { temp + wholeCount, static_cast<std::size_t>(digitCount - wholeCount) });
+	}
+	// 0.00ddd form.
+	it_ = vectorWriteText(it_, last_, "0.");
+	for (int i = 0; i < -exponent - 1 && it_ != nullptr; i++)
+		it_ = vectorWriteText(it_, last_, "0");
+	return vectorWriteText(it_, last_, { temp, static_cast<std::size_t>(digitCount) });
+}
+
+/// <summary>
+/// Appends one vector component honoring the setup's precision and mantissa mode.
+/// Integers go straight through std::to_chars.
+/// </summary>
+template <typename _type>
+inline char* vectorWriteScalar(char* it_, char* const last_, _type const value_, VectorStringBuilder const & setup_)
+{
+	if (it_ == nullptr)
+		return nullptr;
+	if constexpr (std::is_integral_v<_type>)
+	{
+		auto const result = std::to_chars(it_, last_, value_);
+		return result.ec == std::errc{} ? result.ptr : nullptr;
+	}
+	else
+	{
+		if (setup_.mantissaFixed)
+			return vectorWriteFixedFloat(it_, last_, static_cast<double>(value_), setup_.precision);
+		return vectorWriteGeneralFloat(it_, last_, static_cast<double>(value_), setup_.precision);
+	}
+}
+
+} // namespace detail
+
 } // namespace agdk
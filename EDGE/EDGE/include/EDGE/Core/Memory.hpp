@@ -0,0 +1,5 @@
+#pragma once
+
+#include <EDGE/Core/Memory/Arena.hpp>
+#include <EDGE/Core/Memory/Pool.hpp>
+#include <EDGE/Core/Memory/PoolAllocator.hpp>
@@ -0,0 +1,138 @@
+// File description:
+// Implements a bump ("arena") allocator - cheap pointer-bump allocation, bulk reset.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/NonCopyable.hpp>
+
+namespace edge
+{
+
+/// <summary>
+/// Bump allocator: hands out memory by advancing a cursor inside large blocks.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Individual allocations cannot be freed - call <see cref="reset"/> to recycle
+///		everything at once (blocks are kept, so a reset arena allocates without
+///		touching the heap again). Ideal for per-frame scratch data and as slab
+///		backing for pools.
+/// </para>
+/// </remarks>
+class MemoryArena
+	: INonCopyable
+{
+public:
+	// Helper typedefs:
+	using SizeType = std::size_t;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="MemoryArena"/> class.
+	/// </summary>
+	/// <param name="blockSize_">Size of each internally allocated block, in bytes.</param>
+	explicit MemoryArena(SizeType const blockSize_ = 64 * 1024)
+		:
+		m_blockSize{ std::max<SizeType>(blockSize_, MinimalBlockSize) },
+		m_blockIndex{ 0 },
+		m_cursor{ 0 }
+	{
+	}
+
+	/// <summary>
+	/// Allocates `size_` bytes with the requested alignment.
+	/// </summary>
+	/// <param name="size_">Number of bytes.</param>
+	/// <param name="alignment_">Required alignment (power of two).</param>
+	/// <returns>Pointer to uninitialized storage, valid until reset() or destruction.</returns>
+	void* allocate(SizeType const size_, SizeType const alignment_ = alignof(std::max_align_t))
+	{
+		// # Assertion note:
+		// Alignment must be a power of two - every standard alignment is.
+		assert(alignment_ != 0 && (alignment_ & (alignment_ - 1)) == 0);
+
+		// Oversized requests get a dedicated block (inserted behind the cursor, so it is not bumped into).
+		if (size_ + alignment_ > m_blockSize)
+		{
+			auto& block = *m_blocks.emplace(m_blocks.begin() + m_blockIndex,
+				Block{ std::make_unique<std::byte[]>(size_ + alignment_), size_ + alignment_ });
+			m_blockIndex++;
+			return alignPointer(block.memory.get(), alignment_);
+		}
+
+		for (;;)
+		{
+			if (m_blockIndex < m_blocks.size())
+			{
+				auto& block			= m_blocks[m_blockIndex];
+				auto* base			= block.memory.get() + m_cursor;
+				auto* aligned		= alignPointer(base, alignment_);
+				auto const needed	= static_cast<SizeType>(aligned - block.memory.get()) + size_;
+				if (needed <= block.size)
+				{
+					m_cursor = needed;
+					return aligned;
+				}
+				// Block exhausted - move on to the next one.
+				m_blockIndex++;
+				m_cursor = 0;
+				continue;
+			}
+			m_blocks.push_back(Block{ std::make_unique<std::byte[]>(m_blockSize), m_blockSize });
+		}
+	}
+
+	/// <summary>
+	/// Recycles every allocation at once. Blocks are kept for reuse.
+	/// </summary>
+	void reset()
+	{
+		m_blockIndex	= 0;
+		m_cursor		= 0;
+	}
+
+	/// <summary>
+	/// Returns total number of bytes reserved from the heap.
+	/// </summary>
+	/// <returns>Total reserved bytes.</returns>
+	SizeType totalReserved() const
+	{
+		SizeType total = 0;
+		for (auto const & block : m_blocks)
+			total += block.size;
+		return total;
+	}
+
+private:
+
+	constexpr static SizeType MinimalBlockSize = 256;
+
+	/// <summary>
+	/// Aligns the pointer upwards to the requested alignment.
+	/// </summary>
+	/// <param name="pointer_">The pointer.</param>
+	/// <param name="alignment_">The alignment (power of two).</param>
+	/// <returns>Aligned pointer.</returns>
+	static std::byte* alignPointer(std::byte* const pointer_, SizeType const alignment_)
+	{
+		auto const address = reinterpret_cast<std::uintptr_t>(pointer_);
+		return pointer_ + ((alignment_ - (address & (alignment_ - 1))) & (alignment_ - 1));
+	}
+
+	// Single heap block the cursor bumps through.
+	struct Block
+	{
+		std::unique_ptr<std::byte[]>	memory;
+		SizeType						size;
+	};
+
+	std::vector<Block>	m_blocks;		// all reserved blocks (kept across resets)
+	SizeType			m_blockSize;	// size of regularly allocated blocks
+	SizeType			m_blockIndex;	// block the cursor currently lives in
+	SizeType			m_cursor;		// bump offset inside the current block
+};
+
+} // namespace edge
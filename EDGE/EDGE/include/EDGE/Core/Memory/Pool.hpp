@@ -0,0 +1,105 @@
+// File description:
+// Implements a fixed-size block pool allocator with a free list and slab growth.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/Memory/Arena.hpp>
+
+namespace edge
+{
+
+/// <summary>
+/// Pool of equally sized memory blocks with O(1) allocate/deallocate.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Freed blocks go onto an intrusive free list and are handed out again before
+///		any new slab is carved - steady-state usage does not touch the heap. Slabs
+///		are backed by a <see cref="MemoryArena"/> and released only on destruction.
+/// </para>
+/// </remarks>
+class FixedSizePool
+	: INonCopyable
+{
+public:
+	// Helper typedefs:
+	using SizeType = std::size_t;
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="FixedSizePool"/> class.
+	/// </summary>
+	/// <param name="blockSize_">Size of a single block, in bytes.</param>
+	/// <param name="blocksPerSlab_">How many blocks to carve per slab when the pool grows.</param>
+	explicit FixedSizePool(SizeType const blockSize_, SizeType const blocksPerSlab_ = 256)
+		:
+		m_blockSize{ std::max<SizeType>(blockSize_, sizeof(FreeNode)) },
+		m_blocksPerSlab{ std::max<SizeType>(blocksPerSlab_, 1) },
+		m_slabs{ m_blockSize * m_blocksPerSlab + alignof(std::max_align_t) },
+		m_freeList{ nullptr }
+	{
+	}
+
+	/// <summary>
+	/// Allocates one block.
+	/// </summary>
+	/// <returns>Pointer to uninitialized storage of blockSize() bytes.</returns>
+	void* allocate()
+	{
+		if (m_freeList == nullptr)
+			this->carveSlab();
+
+		auto* node = m_freeList;
+		m_freeList = node->next;
+		return node;
+	}
+
+	/// <summary>
+	/// Returns the block to the pool.
+	/// </summary>
+	/// <param name="block_">Block previously obtained from allocate().</param>
+	void deallocate(void* const block_)
+	{
+		auto* node	= static_cast<FreeNode*>(block_);
+		node->next	= m_freeList;
+		m_freeList	= node;
+	}
+
+	/// <summary>
+	/// Returns the (possibly rounded up) size of a single block.
+	/// </summary>
+	/// <returns>Block size in bytes.</returns>
+	SizeType blockSize() const {
+		return m_blockSize;
+	}
+
+private:
+
+	// Intrusive free list node, stored inside unused blocks.
+	struct FreeNode
+	{
+		FreeNode* next;
+	};
+
+	/// <summary>
+	/// Carves a fresh slab from the arena and threads its blocks onto the free list.
+	/// </summary>
+	void carveSlab()
+	{
+		auto* slab = static_cast<std::byte*>(
+			m_slabs.allocate(m_blockSize * m_blocksPerSlab, alignof(std::max_align_t)) );
+
+		for (SizeType i = 0; i < m_blocksPerSlab; i++)
+			this->deallocate(slab + i * m_blockSize);
+	}
+
+	SizeType	m_blockSize;		// size of a single block
+	SizeType	m_blocksPerSlab;	// blocks carved per slab
+	MemoryArena	m_slabs;			// slab backing storage
+	FreeNode*	m_freeList;			// intrusive list of free blocks
+};
+
+} // namespace edge
@@ -0,0 +1,172 @@
+// File description:
+// Implements a std-allocator adapter over thread-local size-class pools.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/Memory/Pool.hpp>
+
+namespace edge
+{
+
+namespace memory
+{
+
+namespace detail
+{
+
+/// <summary>
+/// Per-thread set of fixed-size pools, one per power-of-two size class (8..1024 bytes).
+/// </summary>
+/// <remarks>
+/// <para>
+///		Allocations above the largest class fall through to the global heap.
+///		Blocks must be freed on the thread that allocated them - containers using
+///		<see cref="PoolAllocator"/> therefore have thread affinity.
+/// </para>
+/// </remarks>
+class ThreadLocalPools
+{
+public:
+	constexpr static std::size_t SmallestClass	= 8;
+	constexpr static std::size_t LargestClass	= 1024;
+	constexpr static std::size_t NumberOfClasses	= 8; // 8, 16, 32, 64, 128, 256, 512, 1024
+
+	/// <summary>
+	/// Returns this thread's pool set.
+	/// </summary>
+	/// <returns>Reference to the thread-local instance.</returns>
+	static ThreadLocalPools& instance()
+	{
+		thread_local ThreadLocalPools pools;
+		return pools;
+	}
+
+	/// <summary>
+	/// Allocates `bytes_` bytes from the matching size-class pool (or the heap above LargestClass).
+	/// </summary>
+	/// <param name="bytes_">Number of bytes.</param>
+	/// <returns>Pointer to uninitialized storage.</returns>
+	void* allocate(std::size_t const bytes_)
+	{
+		if (bytes_ > LargestClass)
+			return ::operator new(bytes_);
+		return m_pools[classIndex(bytes_)].allocate();
+	}
+
+	/// <summary>
+	/// Returns storage previously obtained from allocate() with the same byte count.
+	/// </summary>
+	/// <param name="pointer_">The storage.</param>
+	/// <param name="bytes_">Number of bytes passed to allocate().</param>
+	void deallocate(void* const pointer_, std::size_t const bytes_)
+	{
+		if (bytes_ > LargestClass)
+		{
+			::operator delete(pointer_);
+			return;
+		}
+		m_pools[classIndex(bytes_)].deallocate(pointer_);
+	}
+
+private:
+
+	ThreadLocalPools()
+		: m_pools{
+			FixedSizePool{ 8 },   FixedSizePool{ 16 },  FixedSizePool{ 32 },  FixedSizePool{ 64 },
+			FixedSizePool{ 128 }, FixedSizePool{ 256 }, FixedSizePool{ 512 }, FixedSizePool{ 1024 }
+		}
+	{
+	}
+
+	/// <summary>
+	/// Maps a byte count to its size-class index.
+	/// </summary>
+	/// <param name="bytes_">Number of bytes (must be <= LargestClass).</param>
+	/// <returns>Index into the pool array.</returns>
+	static std::size_t classIndex(std::size_t const bytes_)
+	{
+		std::size_t index	= 0;
+		std::size_t size	= SmallestClass;
+		while (size < bytes_)
+		{
+			size <<= 1;
+			index++;
+		}
+		return index;
+	}
+
+	FixedSizePool m_pools[NumberOfClasses];
+};
+
+} // namespace detail
+
+} // namespace memory
+
+/// <summary>
+/// Standard allocator adapter backed by thread-local size-class pools.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Containers using it reuse freed blocks from this thread's pools, making
+///		steady-state growth allocation-free. The trade-off is thread affinity:
+///		allocate and deallocate must happen on the same thread. Over-aligned
+///		value types fall back to the global heap.
+/// </para>
+/// </remarks>
+template <typename _type>
+class PoolAllocator
+{
+public:
+	// Helper typedefs (standard allocator interface):
+	using value_type = _type;
+
+	PoolAllocator() = default;
+
+	template <typename _other>
+	PoolAllocator(PoolAllocator<_other> const &) { }
+
+	/// <summary>
+	/// Allocates storage for `count_` objects.
+	/// </summary>
+	/// <param name="count_">Number of objects.</param>
+	/// <returns>Pointer to uninitialized storage.</returns>
+	_type* allocate(std::size_t const count_)
+	{
+		if constexpr (alignof(_type) > alignof(std::max_align_t))
+			return static_cast<_type*>( ::operator new(count_ * sizeof(_type), std::align_val_t{ alignof(_type) }) );
+		else
+			return static_cast<_type*>( memory::detail::ThreadLocalPools::instance().allocate(count_ * sizeof(_type)) );
+	}
+
+	/// <summary>
+	/// Frees storage previously obtained from allocate() on this thread.
+	/// </summary>
+	/// <param name="pointer_">The storage.</param>
+	/// <param name="count_">Number of objects passed to allocate().</param>
+	void deallocate(_type* const pointer_, std::size_t const count_)
+	{
+		if constexpr (alignof(_type) > alignof(std::max_align_t))
+			::operator delete(pointer_, std::align_val_t{ alignof(_type) });
+		else
+			memory::detail::ThreadLocalPools::instance().deallocate(pointer_, count_ * sizeof(_type));
+	}
+};
+
+/// <summary>
+/// All PoolAllocator instances of a type are interchangeable on the same thread.
+/// </summary>
+template <typename _left, typename _right>
+bool operator==(PoolAllocator<_left> const &, PoolAllocator<_right> const &) {
+	return true;
+}
+
+template <typename _left, typename _right>
+bool operator!=(PoolAllocator<_left> const &, PoolAllocator<_right> const &) {
+	return false;
+}
+
+} // namespace edge
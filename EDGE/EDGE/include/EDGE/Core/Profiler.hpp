@@ -0,0 +1,141 @@
+// File description:
+// Implements the engine profiler - scoped zones in per-thread ring buffers, exported as chrome://tracing JSON.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/NonCopyable.hpp>
+
+namespace edge
+{
+
+/// <summary>
+/// Collects scoped timing zones into per-thread ring buffers.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Use the <c>EDGE_PROFILE_SCOPE("name")</c> macro rather than this class
+///		directly - when <c>EDGE_PROFILE</c> is 0 (the release default, toggled in
+///		Compilation/API.hpp) the macro compiles away entirely. A recorded zone
+///		costs two clock reads and a ring buffer store on its own thread; older
+///		zones are overwritten once a thread's ring is full.
+/// </para>
+/// <para>
+///		<see cref="exportTrace"/> writes the chrome://tracing JSON format -
+///		open the file under <c>chrome://tracing</c> (or Perfetto) to inspect it.
+///		Export while other threads still record is best effort: zones written
+///		during the export may be mixed in partially.
+/// </para>
+/// </remarks>
+class Profiler
+	: INonCopyable
+{
+public:
+	// Zones each thread keeps before the oldest get overwritten.
+	constexpr static std::size_t ZonesPerThread = 8192;
+
+	/// <summary>
+	/// A single recorded zone. The name must point to storage outliving the profiler (string literals).
+	/// </summary>
+	struct Zone
+	{
+		char const *	name;
+		std::uint64_t	beginNs;
+		std::uint64_t	endNs;
+	};
+
+	/// <summary>
+	/// Records the zone spanning its own lifetime - the type behind EDGE_PROFILE_SCOPE.
+	/// </summary>
+	class ScopedZone
+	{
+	public:
+		explicit ScopedZone(char const * const name_)
+			: m_name{ name_ }, m_beginNs{ Profiler::now() }
+		{
+		}
+
+		~ScopedZone()
+		{
+			Profiler::instance().record(m_name, m_beginNs, Profiler::now());
+		}
+
+	private:
+		char const * const	m_name;
+		std::uint64_t const	m_beginNs;
+	};
+
+	/// <summary>
+	/// Returns the engine-wide profiler (created on first use).
+	/// </summary>
+	/// <returns>Reference to the global instance.</returns>
+	static Profiler& instance();
+
+	/// <summary>
+	/// Returns the current timestamp.
+	/// </summary>
+	/// <returns>Nanoseconds on the steady clock.</returns>
+	static std::uint64_t now()
+	{
+		return static_cast<std::uint64_t>(
+			std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch() ).count() );
+	}
+
+	/// <summary>
+	/// Stores one zone in the calling thread's ring buffer.
+	/// </summary>
+	/// <param name="name_">Zone name (must outlive the profiler - pass a string literal).</param>
+	/// <param name="beginNs_">Zone begin, from <see cref="now"/>.</param>
+	/// <param name="endNs_">Zone end, from <see cref="now"/>.</param>
+	void record(char const * const name_, std::uint64_t const beginNs_, std::uint64_t const endNs_);
+
+	/// <summary>
+	/// Writes every recorded zone as chrome://tracing JSON.
+	/// </summary>
+	/// <param name="output_">The output stream.</param>
+	void exportTrace(std::ostream & output_);
+
+	/// <summary>
+	/// Discards every recorded zone (the per-thread buffers stay allocated).
+	/// </summary>
+	void clear();
+
+private:
+
+	/// <summary>
+	/// One thread's ring buffer, registered on that thread's first record().
+	/// </summary>
+	struct ThreadBuffer
+	{
+		std::uint32_t						threadId;
+		std::atomic<std::uint64_t>			zoneCount{ 0 };	// total ever recorded; ring index is zoneCount % ZonesPerThread
+		std::array<Zone, ZonesPerThread>	zones;
+	};
+
+	/// <summary>
+	/// Returns the calling thread's buffer, registering it on first use.
+	/// </summary>
+	/// <returns>Reference to the thread-local buffer.</returns>
+	ThreadBuffer& localBuffer();
+
+	std::mutex										m_threadsMutex;	// guards m_threads against concurrent registration
+	std::vector< std::unique_ptr<ThreadBuffer> >	m_threads;		// kept until program end - exiting threads leave their zones behind
+};
+
+} // namespace edge
+
+// Helpers giving each EDGE_PROFILE_SCOPE in a function a unique variable name.
+#define EDGE_DETAIL_PROFILE_CONCAT2(a_, b_)	a_##b_
+#define EDGE_DETAIL_PROFILE_CONCAT(a_, b_)	EDGE_DETAIL_PROFILE_CONCAT2(a_, b_)
+
+#if EDGE_PROFILE
+	/// Records the enclosing scope as a profiler zone. `name_` must be a string literal.
+	#define EDGE_PROFILE_SCOPE(name_) \
+		::edge::Profiler::ScopedZone EDGE_DETAIL_PROFILE_CONCAT(edgeProfileZone, __LINE__){ name_ }
+#else
+	#define EDGE_PROFILE_SCOPE(name_) static_cast<void>(0)
+#endif
@@ -0,0 +1,152 @@
+// File description:
+// Implements lightweight non-owning view over a contiguous array of elements.
+// Minimal replacement for std::span, which is not available in our toolset yet.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+namespace edge
+{
+
+/// <summary>
+/// Non-owning view over a contiguous sequence of elements.
+/// </summary>
+/// <remarks>
+/// <para>Use <c>Span&lt;Type const&gt;</c> for read-only access.</para>
+/// </remarks>
+template <typename _type>
+class Span
+{
+public:
+	using ElementType	= _type;
+	using ValueType		= std::remove_cv_t<_type>;
+	using SizeType		= std::size_t;
+
+	/// <summary>
+	/// Initializes a new (empty) instance of the <see cref="Span"/> class.
+	/// </summary>
+	constexpr Span()
+		: m_data{ nullptr }, m_size{ 0 }
+	{
+	}
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Span"/> class.
+	/// </summary>
+	/// <param name="data_">Pointer to the first element.</param>
+	/// <param name="size_">Number of elements.</param>
+	constexpr Span(ElementType* data_, SizeType const size_)
+		: m_data{ data_ }, m_size{ size_ }
+	{
+	}
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Span"/> class from a builtin array.
+	/// </summary>
+	/// <param name="array_">The array.</param>
+	template <SizeType _count>
+	constexpr Span(ElementType (&array_)[_count])
+		: m_data{ array_ }, m_size{ _count }
+	{
+	}
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="Span"/> class from a contiguous container
+	/// (e.g. std::vector, std::array).
+	/// </summary>
+	/// <param name="container_">The container.</param>
+	template <typename _container,
+		typename = std::enable_if_t<
+			std::is_convertible_v<
+				decltype( std::declval<_container&>().data() ),
+				ElementType*
+			>
+		> >
+	constexpr Span(_container& container_)
+		: m_data{ container_.data() }, m_size{ container_.size() }
+	{
+	}
+
+	/// <summary>
+	/// Converts to a span of constant elements.
+	/// </summary>
+	/// <returns>Read-only span over the same elements.</returns>
+	constexpr operator Span<ElementType const>() const {
+		return Span<ElementType const>{ m_data, m_size };
+	}
+
+	/// <summary>
+	/// Returns pointer to the first element.
+	/// </summary>
+	/// <returns>Pointer to the first element.</returns>
+	constexpr ElementType* data() const {
+		return m_data;
+	}
+
+	/// <summary>
+	/// Returns number of elements in the span.
+	/// </summary>
+	/// <returns>Number of elements in the span.</returns>
+	constexpr SizeType size() const {
+		return m_size;
+	}
+
+	/// <summary>
+	/// Determines whether the span is empty.
+	/// </summary>
+	/// <returns>
+	///  <c>true</c> if span is empty; otherwise, <c>false</c>.
+	/// </returns>
+	constexpr bool empty() const {
+		return m_size == 0;
+	}
+
+	/// <summary>
+	/// Returns element with specified index by ref.
+	/// </summary>
+	/// <param name="index_">The element index.</param>
+	/// <returns>Element with specified index by ref.</returns>
+	constexpr ElementType& operator[](SizeType const index_) const {
+		// # Assertion note:
+		// You tried to access element beyond the viewed sequence. Fix your code.
+		assert(index_ < m_size);
+		return m_data[index_];
+	}
+
+	/// <summary>
+	/// Returns iterator (pointer) to the first element.
+	/// </summary>
+	/// <returns>Iterator (pointer) to the first element.</returns>
+	constexpr ElementType* begin() const {
+		return m_data;
+	}
+
+	/// <summary>
+	/// Returns iterator (pointer) to the one-past-last element.
+	/// </summary>
+	/// <returns>Iterator (pointer) to the one-past-last element.</returns>
+	constexpr ElementType* end() const {
+		return m_data + m_size;
+	}
+
+	/// <summary>
+	/// Returns subview starting at specified offset.
+	/// </summary>
+	/// <param name="offset_">Index of the first viewed element.</param>
+	/// <param name="count_">Number of viewed elements.</param>
+	/// <returns>Subview starting at specified offset.</returns>
+	constexpr Span<ElementType> subspan(SizeType const offset_, SizeType const count_) const {
+		// # Assertion note:
+		// Requested subview does not fit inside the viewed sequence. Fix your code.
+		assert(offset_ + count_ <= m_size);
+		return Span<ElementType>{ m_data + offset_, count_ };
+	}
+
+private:
+	ElementType*	m_data;
+	SizeType		m_size;
+};
+
+} // namespace edge
@@ -0,0 +1,369 @@
+// File description:
+// Implements a hierarchical timer wheel for large numbers of gameplay timers.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/NonCopyable.hpp>
+#include <EDGE/Core/Profiler.hpp>
+
+namespace edge
+{
+
+/// <summary>
+/// Hierarchical timer wheel scheduling tens of thousands of timers in O(1) per operation.
+/// </summary>
+/// <remarks>
+/// <para>
+///		A std::priority_queue pays O(log n) per schedule, cancel (usually via lazy
+///		deletion) and expiry, which adds up when buffs, cooldowns and respawns keep
+///		tens of thousands of timers in flight. The wheel buckets timers by expiry
+///		tick into four levels of 64 slots (the classic hashed hierarchical wheel):
+///		schedule and cancel are a list insert/unlink, and advancing a tick touches
+///		only the one slot that expires, cascading a higher-level slot down on each
+///		level rollover.
+/// </para>
+/// <para>
+///		Time is discretized into ticks (1 ms by default - delays round up, so a
+///		timer never fires early and fires at most one tick late). Four levels of
+///		64 slots cover 64^4 ticks (about 4.6 hours at 1 ms); longer delays park in
+///		the top level and re-cascade, so they only cost extra moves, not errors.
+///		Drive it from the <see cref="GameLoop"/> update callback:
+///		<c>wheel.advance(std::chrono::duration&lt;double&gt;{ dt });</c>
+/// </para>
+/// <para>
+///		Callbacks run inside advance() and may freely schedule() and cancel() -
+///		including the running timer itself. Not synchronized - the wheel belongs
+///		to the thread ticking it.
+/// </para>
+/// </remarks>
+class TimerWheel
+	: INonCopyable
+{
+public:
+	using Duration	= std::chrono::steady_clock::duration;
+	using Callback	= std::function<void()>;
+
+	/// <summary>
+	/// Handle of a scheduled timer (generation-checked, safe to keep after expiry).
+	/// </summary>
+	struct TimerId
+	{
+		std::uint32_t index			= invalidIndex;
+		std::uint32_t generation	= 0;
+
+		/// <summary>
+		/// Determines whether the handle ever pointed at a timer.
+		/// </summary>
+		constexpr explicit operator bool() const {
+			return index != invalidIndex;
+		}
+		constexpr bool operator==(TimerId const other_) const {
+			return index == other_.index && generation == other_.generation;
+		}
+		constexpr bool operator!=(TimerId const other_) const {
+			return !(*this == other_);
+		}
+	};
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="TimerWheel"/> class.
+	/// </summary>
+	/// <param name="tickDuration_">Granularity of the wheel; delays round up to whole ticks.</param>
+	explicit TimerWheel(Duration const tickDuration_ = std::chrono::milliseconds{ 1 })
+		: m_tickDuration{ tickDuration_ }
+	{
+		// # Assertion note:
+		// A non-positive tick would make advance() spin forever.
+		assert(tickDuration_ > Duration::zero());
+
+		for (auto & level : m_slots)
+			level.fill(invalidIndex);
+	}
+
+	/// <summary>
+	/// Schedules a one-shot timer.
+	/// </summary>
+	/// <param name="delay_">Delay before the callback fires (rounds up to whole ticks).</param>
+	/// <param name="callback_">The callback to invoke.</param>
+	/// <returns>Handle usable with <see cref="cancel"/>.</returns>
+	TimerId schedule(Duration const delay_, Callback callback_)
+	{
+		return this->schedule(delay_, Duration::zero(), std::move(callback_));
+	}
+
+	/// <summary>
+	/// Schedules a timer, optionally repeating.
+	/// </summary>
+	/// <param name="delay_">Delay before the first invocation.</param>
+	/// <param name="interval_">Interval between repeats (zero = one-shot).</param>
+	/// <param name="callback_">The callback to invoke.</param>
+	/// <returns>Handle usable with <see cref="cancel"/>.</returns>
+	TimerId schedule(Duration const delay_, Duration const interval_, Callback callback_)
+	{
+		std::uint32_t const index = this->allocateTimer();
+
+		Timer & timer		= m_timers[index];
+		timer.expiry		= m_currentTick + std::max<std::uint64_t>(this->toTicks(delay_), 1);
+		timer.intervalTicks	= this->toTicks(interval_);
+		timer.callback		= std::move(callback_);
+
+		this->place(index);
+		++m_activeCount;
+		return { index, timer.generation };
+	}
+
+	/// <summary>
+	/// Cancels a scheduled timer.
+	/// </summary>
+	/// <param name="id_">Handle returned by <see cref="schedule"/>.</param>
+	/// <returns>True when the timer was still pending, false when already fired or cancelled.</returns>
+	bool cancel(TimerId const id_)
+	{
+		if (id_.index >= m_timers.size() || m_timers[id_.index].generation != id_.generation)
+			return false;
+
+		this->unlink(id_.index);
+		this->freeTimer(id_.index);
+		--m_activeCount;
+		return true;
+	}
+
+	/// <summary>
+	/// Advances the wheel by the given amount of time, firing due timers.
+	/// </summary>
+	/// <param name="elapsed_">Time elapsed since the previous call (fractional ticks carry over).</param>
+	void advance(Duration const elapsed_)
+	{
+		EDGE_PROFILE_SCOPE("TimerWheel::advance");
+
+		m_tickRemainder += elapsed_;
+		while (m_tickRemainder >= m_tickDuration)
+		{
+			m_tickRemainder -= m_tickDuration;
+			this->tick();
+		}
+	}
+
+	/// <summary>
+	/// Returns number of pending timers.
+	/// </summary>
+	/// <returns>Number of pending timers.</returns>
+	std::size_t size() const {
+		return m_activeCount;
+	}
+
+	/// <summary>
+	/// Returns number of whole ticks processed so far.
+	/// </summary>
+	/// <returns>Number of whole ticks processed so far.</returns>
+	std::uint64_t getCurrentTick() const {
+		return m_currentTick;
+	}
+
+	/// <summary>
+	/// Returns granularity of the wheel.
+	/// </summary>
+	/// <returns>Granularity of the wheel.</returns>
+	Duration getTickDuration() const {
+		return m_tickDuration;
+	}
+
+private:
+
+	static constexpr std::uint32_t	invalidIndex	= 0xffffffffu;
+	static constexpr std::size_t	levelBits		= 6;						// 64 slots per level
+	static constexpr std::size_t	slotsPerLevel	= std::size_t{ 1 } << levelBits;
+	static constexpr std::size_t	levelCount		= 4;						// 64^4 ticks of range
+
+	/// <summary>
+	/// One scheduled timer, linked into its slot's doubly-linked list by index.
+	/// </summary>
+	struct Timer
+	{
+		std::uint64_t	expiry			= 0;	// absolute tick
+		std::uint64_t	intervalTicks	= 0;	// 0 = one-shot
+		Callback		callback;
+		std::uint32_t	generation		= 0;
+		std::uint32_t	next			= invalidIndex;
+		std::uint32_t	prev			= invalidIndex;
+		std::uint8_t	level			= 0;
+		std::uint8_t	slot			= 0;
+		bool			linked			= false;
+	};
+
+	/// <summary>
+	/// Converts a duration to whole ticks, rounding up (a timer never fires early).
+	/// </summary>
+	std::uint64_t toTicks(Duration const duration_) const
+	{
+		if (duration_ <= Duration::zero())
+			return 0;
+		auto const count = static_cast<std::uint64_t>(duration_.count());
+		auto const tick	= static_cast<std::uint64_t>(m_tickDuration.count());
+		return (count + tick - 1) / tick;
+	}
+
+	/// <summary>
+	/// Takes a timer slot from the free list (growing the pool when empty).
+	/// </summary>
+	std::uint32_t allocateTimer()
+	{
+		if (m_freeHead != invalidIndex)
+		{
+			std::uint32_t const index = m_freeHead;
+			m_freeHead = m_timers[index].next;
+			m_timers[index].next = invalidIndex;
+			return index;
+		}
+		m_timers.emplace_back();
+		return static_cast<std::uint32_t>(m_timers.size() - 1);
+	}
+
+	/// <summary>
+	/// Returns a timer to the free list, invalidating outstanding handles.
+	/// </summary>
+	void freeTimer(std::uint32_t const index_)
+	{
+		Timer & timer = m_timers[index_];
+		++timer.generation;		// outstanding TimerIds stop matching
+		timer.callback = nullptr;
+		timer.next = m_freeHead;
+		timer.prev = invalidIndex;
+		m_freeHead = index_;
+	}
+
+	/// <summary>
+	/// Links a timer into the slot matching its expiry.
+	/// </summary>
+	/// <remarks>
+	///		A timer at distance d lands in the lowest level whose span exceeds d;
+	///		its slot within the level is the matching digit of the expiry tick in
+	///		base 64. Expiries beyond the whole wheel park in the outermost level
+	///		and cascade again when it rolls around.
+	/// </remarks>
+	void place(std::uint32_t const index_)
+	{
+		Timer & timer = m_timers[index_];
+
+		std::uint64_t const distance = timer.expiry - m_currentTick;
+
+		std::size_t level = 0;
+		while (level + 1 < levelCount && distance >= (std::uint64_t{ 1 } << (levelBits * (level + 1))))
+			++level;
+
+		std::size_t const slot = (timer.expiry >> (levelBits * level)) & (slotsPerLevel - 1);
+
+		timer.level		= static_cast<std::uint8_t>(level);
+		timer.slot		= static_cast<std::uint8_t>(slot);
+		timer.prev		= invalidIndex;
+		timer.next		= m_slots[level][slot];
+		timer.linked	= true;
+		if (timer.next != invalidIndex)
+			m_timers[timer.next].prev = index_;
+		m_slots[level][slot] = index_;
+	}
+
+	/// <summary>
+	/// Unlinks a timer from its slot list.
+	/// </summary>
+	void unlink(std::uint32_t const index_)
+	{
+		Timer & timer = m_timers[index_];
+		if (!timer.linked)
+			return;
+
+		if (timer.prev != invalidIndex)
+			m_timers[timer.prev].next = timer.next;
+		else
+			m_slots[timer.level][timer.slot] = timer.next;
+		if (timer.next != invalidIndex)
+			m_timers[timer.next].prev = timer.prev;
+
+		timer.next		= invalidIndex;
+		timer.prev		= invalidIndex;
+		timer.linked	= false;
+	}
+
+	/// <summary>
+	/// Advances the wheel by one tick: cascades on rollover, then fires the due slot.
+	/// </summary>
+	void tick()
+	{
+		++m_currentTick;
+
+		// Each time a level's digit rolls over, re-place that level's next slot
+		// from the level above - timers either drop a level or come due.
+		for (std::size_t level = 1; level < levelCount; ++level)
+		{
+			if ((m_currentTick & ((std::uint64_t{ 1 } << (levelBits * level)) - 1)) != 0)
+				break;
+			std::size_t const slot = (m_currentTick >> (levelBits * level)) & (slotsPerLevel - 1);
+			this->cascade(level, slot);
+		}
+
+		std::uint32_t index = m_slots[0][m_currentTick & (slotsPerLevel - 1)];
+		while (index != invalidIndex)
+		{
+			// Level 0 holds only timers of the current 64-tick window, so the
+			// whole slot is due this very tick.
+			Timer & timer = m_timers[index];
+			assert(timer.expiry == m_currentTick);
+
+			this->unlink(index);
+			std::uint64_t const interval = timer.intervalTicks;
+
+			if (interval != 0)
+			{
+				// Re-arm first, then run a copy - the callback may cancel its
+				// own timer (or reschedule) without pulling the rug out.
+				timer.expiry = m_currentTick + interval;
+				this->place(index);
+				Callback const callback = timer.callback;
+				callback();
+			}
+			else
+			{
+				Callback callback = std::move(timer.callback);
+				this->freeTimer(index);
+				--m_activeCount;
+				callback();
+			}
+
+			// Callbacks may mutate the wheel - re-read the slot head instead of
+			// trusting a next pointer captured before the call.
+			index = m_slots[0][m_currentTick & (slotsPerLevel - 1)];
+		}
+	}
+
+	/// <summary>
+	/// Re-places every timer of a higher-level slot one level down.
+	/// </summary>
+	void cascade(std::size_t const level_, std::size_t const slot_)
+	{
+		std::uint32_t index = m_slots[level_][slot_];
+		m_slots[level_][slot_] = invalidIndex;
+
+		while (index != invalidIndex)
+		{
+			std::uint32_t const next = m_timers[index].next;
+			m_timers[index].linked = false;
+			this->place(index);
+			index = next;
+		}
+	}
+
+	Duration		m_tickDuration;
+	Duration		m_tickRemainder	= Duration::zero();
+	std::uint64_t	m_currentTick	= 0;
+	std::size_t		m_activeCount	= 0;
+	std::uint32_t	m_freeHead		= invalidIndex;
+
+	std::vector<Timer>												m_timers;
+	std::array<std::array<std::uint32_t, slotsPerLevel>, levelCount>	m_slots;
+};
+
+} // namespace edge
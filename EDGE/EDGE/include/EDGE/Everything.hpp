@@ -6,12 +6,22 @@
 
 #include EDGE_PCH
 
+#include <EDGE/Core/Concurrency.hpp>
 #include <EDGE/Core/EventDispatcher.hpp>
+#include <EDGE/Core/FrameClock.hpp>
+#include <EDGE/Core/GameLoop.hpp>
+#include <EDGE/Core/HashedString.hpp>
+#include <EDGE/Core/TimerWheel.hpp>
+#include <EDGE/Core/Memory.hpp>
 #include <EDGE/Core/NonCopyable.hpp>
 #include <EDGE/Core/NonInstantiable.hpp>
+#include <EDGE/Core/Profiler.hpp>
+#include <EDGE/Core/Span.hpp>
 #include <EDGE/Core/TypeTraits.hpp>
 
 #include <EDGE/Core/Math.hpp>
 #include <EDGE/Core/Color.hpp>
 #include <EDGE/Core/IO.hpp>
 
+#include <EDGE/Graphics/SpriteBatch.hpp>
+
@@ -0,0 +1,121 @@
+// File description:
+// Implements batched quad rendering over the SFML layer.
+
+#pragma once
+
+// Precompiled header:
+#include EDGE_PCH
+
+// Custom includes:
+#include <EDGE/Core/NonCopyable.hpp>
+
+namespace edge
+{
+
+/// <summary>
+/// Accumulates sprites into per-texture vertex buckets and flushes them with a
+/// handful of draw calls per frame.
+/// </summary>
+/// <remarks>
+/// <para>
+///		Drawing sf::Drawable objects one by one costs one driver call each, which
+///		caps a scene at a few thousand sprites. The batch instead appends two
+///		triangles per sprite to a bucket keyed by texture and uploads every bucket
+///		into a persistent sf::VertexBuffer (stream usage, re-uploaded each flush so
+///		the driver can orphan the previous storage) - the frame then costs one draw
+///		call per distinct texture.
+/// </para>
+/// <para>
+///		Intended use inside the <see cref="GameLoop"/> render callback:
+///		begin() - draw() per sprite - end(target). Sprites sharing a texture keep
+///		their submission order; ordering between different textures follows the
+///		first use of each texture, so depth-sensitive scenes should submit in
+///		layer order. Not synchronized - one batch belongs to the render thread.
+/// </para>
+/// </remarks>
+class EDGE_API SpriteBatch
+	: INonCopyable
+{
+public:
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="SpriteBatch"/> class.
+	/// </summary>
+	/// <param name="bucketCapacity_">Initial vertex capacity reserved per texture bucket.</param>
+	explicit SpriteBatch(std::size_t bucketCapacity_ = 8192);
+
+	/// <summary>
+	/// Starts a new frame: clears every bucket while keeping buffers and allocations.
+	/// </summary>
+	void begin();
+
+	/// <summary>
+	/// Appends a sprite to the batch.
+	/// </summary>
+	/// <param name="sprite_">The sprite (its texture keys the bucket).</param>
+	void draw(sf::Sprite const & sprite_);
+
+	/// <summary>
+	/// Appends a textured quad to the batch.
+	/// </summary>
+	/// <param name="texture_">The texture (keys the bucket).</param>
+	/// <param name="destination_">Target rectangle in world coordinates.</param>
+	/// <param name="textureRect_">Source rectangle in texture pixels.</param>
+	/// <param name="color_">The vertex color.</param>
+	void draw(sf::Texture const & texture_, sf::FloatRect const & destination_,
+		sf::IntRect const & textureRect_, sf::Color const & color_ = sf::Color::White);
+
+	/// <summary>
+	/// Appends pre-built triangle vertices to the batch (count must be a multiple of 3).
+	/// </summary>
+	/// <param name="vertices_">The triangle vertices.</param>
+	/// <param name="count_">Number of vertices.</param>
+	/// <param name="texture_">The texture keying the bucket (null for untextured geometry).</param>
+	void draw(sf::Vertex const* vertices_, std::size_t count_, sf::Texture const* texture_);
+
+	/// <summary>
+	/// Uploads every bucket and issues one draw call per distinct texture.
+	/// </summary>
+	/// <param name="target_">The render target.</param>
+	/// <param name="states_">Base render states (texture is set per bucket).</param>
+	void end(sf::RenderTarget & target_, sf::RenderStates states_ = sf::RenderStates::Default);
+
+	/// <summary>
+	/// Returns number of vertices accumulated since begin().
+	/// </summary>
+	/// <returns>Number of vertices accumulated since begin().</returns>
+	std::size_t vertexCount() const;
+
+	/// <summary>
+	/// Returns number of draw calls issued by the last end().
+	/// </summary>
+	/// <returns>Number of draw calls issued by the last end().</returns>
+	std::size_t drawCallCount() const {
+		return m_drawCallCount;
+	}
+
+private:
+
+	/// <summary>
+	/// Accumulated triangles of one texture, with their persistent GPU buffer.
+	/// </summary>
+	struct Bucket
+	{
+		sf::Texture const*		texture = nullptr;
+		std::vector<sf::Vertex>	vertices;
+		sf::VertexBuffer		buffer{ sf::Triangles, sf::VertexBuffer::Stream };
+		std::size_t				bufferCapacity = 0;
+	};
+
+	/// <summary>
+	/// Returns the bucket of the specified texture, creating it on first use.
+	/// </summary>
+	Bucket& bucketOf(sf::Texture const* texture_);
+
+	std::vector<Bucket>					m_buckets;
+	std::map<sf::Texture const*, std::size_t>	m_bucketIndices;
+	std::size_t							m_bucketCapacity;
+	std::size_t							m_drawCallCount = 0;
+};
+
+} // namespace edge
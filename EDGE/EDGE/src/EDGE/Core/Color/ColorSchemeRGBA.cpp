@@ -0,0 +1,12 @@
+#include "stdafx.h" // PCH.
+
+// Custom includes:
+#include <EDGE/Core/Color/ColorSchemeRGBA.hpp>	// The `ColorSchemeRGBA` header.
+
+namespace edge
+{
+	// Explicit instantiation definition for the canonical 8-bit scheme.
+	// The matching `extern template` declaration in the header keeps every other
+	// TU from re-instantiating it.
+	template class ColorSchemeRGBA<std::uint8_t, 255>;
+}
@@ -0,0 +1,234 @@
+#include "stdafx.h" // PCH.
+
+// Custom includes:
+#include <EDGE/Core/Concurrency/JobSystem.hpp>		// The header of this unit.
+
+namespace edge
+{
+
+namespace detail
+{
+
+/// <summary>
+/// A unit of work tracked by the job system.
+/// </summary>
+struct Job
+{
+	JobSystem::JobFn						work;				// the work to perform
+	std::atomic<std::uint32_t>				pending{ 1 };		// unfinished dependencies + 1 submission guard
+	std::atomic<bool>						finished{ false };	// set once `work` has run
+	std::mutex								dependentsMutex;	// guards `dependents` against concurrent finish
+	std::vector< std::shared_ptr<Job> >		dependents;			// jobs released when this one finishes
+};
+
+/// <summary>
+/// A single worker's deque. The owner pops from the front, thieves steal from the back.
+/// </summary>
+struct JobWorkerQueue
+{
+	std::mutex							mutex;
+	std::deque< std::shared_ptr<Job> >	jobs;
+};
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////
+JobSystem::JobSystem(std::size_t workerCount_)
+	: m_nextQueue{ 0 }, m_running{ true }
+{
+	if (workerCount_ == 0)
+	{
+		auto const hardware = static_cast<std::size_t>( std::thread::hardware_concurrency() );
+		workerCount_ = std::max<std::size_t>(1, hardware > 1 ? hardware - 1 : 1);
+	}
+
+	m_queues.reserve(workerCount_);
+	for (std::size_t i = 0; i < workerCount_; i++)
+		m_queues.push_back( std::make_unique<detail::JobWorkerQueue>() );
+
+	m_workers.reserve(workerCount_);
+	for (std::size_t i = 0; i < workerCount_; i++)
+		m_workers.emplace_back( [this, i] { this->workerLoop(i); } );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+JobSystem::~JobSystem()
+{
+	// Drain remaining jobs on the calling thread so destruction never drops work.
+	while ( this->tryExecuteOne() ) {}
+
+	{
+		std::lock_guard<std::mutex> lock{ m_sleepMutex };
+		m_running.store(false, std::memory_order_relaxed);
+	}
+	m_sleepCv.notify_all();
+
+	for (auto & worker : m_workers)
+		worker.join();
+
+	// A job that was still running during the first drain may have released
+	// dependents after the workers were told to stop - finish those too.
+	while ( this->tryExecuteOne() ) {}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+JobSystem::JobHandle JobSystem::schedule(JobFn job_)
+{
+	return this->schedule( std::move(job_), {} );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+JobSystem::JobHandle JobSystem::schedule(JobFn job_, std::initializer_list<JobHandle> dependencies_)
+{
+	// # Assertion note:
+	// A job without work to perform is most likely a mistake at the call site.
+	assert(job_ != nullptr);
+
+	auto job = std::make_shared<detail::Job>();
+	job->work = std::move(job_);
+
+	// `pending` starts at 1 (the submission guard), so the job cannot get queued
+	// by a finishing dependency before every dependency was registered.
+	for (auto const & dependency : dependencies_)
+	{
+		if ( !dependency.isValid() )
+			continue;
+
+		std::lock_guard<std::mutex> lock{ dependency.m_job->dependentsMutex };
+		if ( !dependency.m_job->finished.load(std::memory_order_acquire) )
+		{
+			job->pending.fetch_add(1, std::memory_order_relaxed);
+			dependency.m_job->dependents.push_back(job);
+		}
+	}
+
+	// Release the submission guard; queue right away when every dependency already finished.
+	if (job->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		this->enqueue(job);
+
+	return JobHandle{ std::move(job) };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+void JobSystem::wait(JobHandle const & handle_)
+{
+	if ( !handle_.isValid() )
+		return;
+
+	while ( !handle_.m_job->finished.load(std::memory_order_acquire) )
+	{
+		// Help with the backlog instead of blocking - this also makes waiting
+		// from inside a job safe (no worker gets parked on its own queue).
+		if ( !this->tryExecuteOne() )
+			std::this_thread::yield();
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+bool JobSystem::isFinished(JobHandle const & handle_) const
+{
+	return !handle_.isValid() || handle_.m_job->finished.load(std::memory_order_acquire);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+JobSystem& JobSystem::global()
+{
+	static JobSystem instance;
+	return instance;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+void JobSystem::enqueue(std::shared_ptr<detail::Job> job_)
+{
+	auto const queueIndex = m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+	{
+		std::lock_guard<std::mutex> lock{ m_queues[queueIndex]->mutex };
+		m_queues[queueIndex]->jobs.push_back( std::move(job_) );
+	}
+	m_sleepCv.notify_one();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+void JobSystem::finish(detail::Job & job_)
+{
+	// `finished` is flipped under the mutex so schedule() either sees it set
+	// or gets its dependent registered - never neither.
+	std::vector< std::shared_ptr<detail::Job> > dependents;
+	{
+		std::lock_guard<std::mutex> lock{ job_.dependentsMutex };
+		job_.finished.store(true, std::memory_order_release);
+		dependents = std::move(job_.dependents);
+	}
+
+	for (auto & dependent : dependents)
+	{
+		if (dependent->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			this->enqueue( std::move(dependent) );
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+std::shared_ptr<detail::Job> JobSystem::takeJob(std::size_t const preferredQueue_)
+{
+	auto const queueCount = m_queues.size();
+
+	// Own queue first (front)...
+	{
+		auto & own = *m_queues[preferredQueue_ % queueCount];
+		std::lock_guard<std::mutex> lock{ own.mutex };
+		if ( !own.jobs.empty() )
+		{
+			auto job = std::move( own.jobs.front() );
+			own.jobs.pop_front();
+			return job;
+		}
+	}
+
+	// ...then steal from the back of the other queues.
+	for (std::size_t offset = 1; offset < queueCount; offset++)
+	{
+		auto & victim = *m_queues[(preferredQueue_ + offset) % queueCount];
+		std::lock_guard<std::mutex> lock{ victim.mutex };
+		if ( !victim.jobs.empty() )
+		{
+			auto job = std::move( victim.jobs.back() );
+			victim.jobs.pop_back();
+			return job;
+		}
+	}
+
+	return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+bool JobSystem::tryExecuteOne()
+{
+	auto job = this->takeJob( m_nextQueue.load(std::memory_order_relaxed) );
+	if (!job)
+		return false;
+
+	job->work();
+	this->finish(*job);
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+void JobSystem::workerLoop(std::size_t const workerIndex_)
+{
+	while ( m_running.load(std::memory_order_relaxed) )
+	{
+		if (auto job = this->takeJob(workerIndex_))
+		{
+			job->work();
+			this->finish(*job);
+			continue;
+		}
+
+		// Nothing to do anywhere - park until new work arrives. The timeout keeps
+		// a worker from oversleeping a notify that raced with the empty check.
+		std::unique_lock<std::mutex> lock{ m_sleepMutex };
+		m_sleepCv.wait_for( lock, std::chrono::milliseconds{ 1 } );
+	}
+}
+
+} // namespace edge
@@ -0,0 +1,120 @@
+#include "stdafx.h" // PCH.
+
+// Custom includes:
+#include <EDGE/Core/GameLoop.hpp>		// The header of this unit.
+#include <EDGE/Core/Profiler.hpp>
+
+namespace edge
+{
+
+namespace
+{
+// Converts a clock duration to seconds as double.
+double toSeconds(GameLoop::Clock::duration const duration_)
+{
+	return std::chrono::duration<double>{ duration_ }.count();
+}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+void GameLoop::setUpdateRate(double const updatesPerSecond_)
+{
+	// # Assertion note:
+	// The update rate must be positive - the accumulator divides frames by it.
+	assert(updatesPerSecond_ > 0);
+
+	m_updateDelta = 1.0 / updatesPerSecond_;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+void GameLoop::setFrameRateLimit(double const framesPerSecond_)
+{
+	m_frameDelta = framesPerSecond_ > 0 ? 1.0 / framesPerSecond_ : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+void GameLoop::setMaxUpdatesPerFrame(std::uint32_t const maxUpdates_)
+{
+	// # Assertion note:
+	// At least one update per frame must be allowed or the simulation never advances.
+	assert(maxUpdates_ > 0);
+
+	m_maxUpdates = maxUpdates_;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+void GameLoop::run()
+{
+	m_running.store(true, std::memory_order_relaxed);
+
+	auto previous		= Clock::now();
+	double accumulator	= 0;
+
+	while ( this->isRunning() )
+	{
+		auto const frameStart	= Clock::now();
+		auto frameTime			= toSeconds(frameStart - previous);
+		previous				= frameStart;
+
+		// Long stalls are clamped, not replayed - see setMaxUpdatesPerFrame().
+		frameTime = std::min(frameTime, m_maxUpdates * m_updateDelta);
+		accumulator += frameTime;
+
+		if (onFrameBegin)
+		{
+			EDGE_PROFILE_SCOPE("GameLoop::frameBegin");
+			onFrameBegin();
+		}
+
+		while (accumulator >= m_updateDelta && this->isRunning())
+		{
+			if (onUpdate)
+			{
+				EDGE_PROFILE_SCOPE("GameLoop::update");
+				onUpdate(m_updateDelta);
+			}
+			accumulator -= m_updateDelta;
+		}
+
+		if (onRender)
+		{
+			EDGE_PROFILE_SCOPE("GameLoop::render");
+			onRender(accumulator / m_updateDelta);
+		}
+
+		// Frame pacing: wait for the frame cap, or - when there is nothing to
+		// render - until the next fixed update is due, so headless builds idle.
+		double waitFor = m_frameDelta;
+		if (!onRender)
+			waitFor = std::max(waitFor, m_updateDelta - accumulator);
+
+		if (waitFor > 0)
+		{
+			this->preciseWait( frameStart + std::chrono::duration_cast<Clock::duration>(
+				std::chrono::duration<double>{ waitFor } ) );
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+void GameLoop::stop()
+{
+	m_running.store(false, std::memory_order_relaxed);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+void GameLoop::preciseWait(Clock::time_point const until_)
+{
+	// OS sleep is only accurate to a scheduler quantum, so sleep up to a small
+	// margin before the deadline and spin (yielding) across the remainder.
+	constexpr std::chrono::milliseconds spinMargin{ 2 };
+
+	auto now = Clock::now();
+	if (until_ - now > spinMargin)
+		std::this_thread::sleep_for(until_ - now - spinMargin);
+
+	while (Clock::now() < until_)
+		std::this_thread::yield();
+}
+
+} // namespace edge
@@ -0,0 +1,136 @@
+#include "stdafx.h" // PCH.
+
+// Custom includes:
+#include <EDGE/Core/IO/BinaryLog.hpp>		// The header of this unit.
+
+namespace edge::binary_log
+{
+
+namespace
+{
+
+/// <summary>
+/// A message descriptor read back from the stream.
+/// </summary>
+struct Descriptor
+{
+	std::string format;		// text with {} placeholders
+	std::string argTypes;	// one type code per argument
+};
+
+// Reads a trivially copyable value from the stream; returns false on a truncated stream.
+template <typename _type>
+bool readRaw(std::istream & input_, _type & value_)
+{
+	input_.read(reinterpret_cast<char*>(&value_), sizeof(_type));
+	return static_cast<bool>(input_);
+}
+
+// Decodes one argument by its type code and prints it; returns false on a bad code or truncation.
+bool decodeArgument(std::istream & input_, char const typeCode_, std::ostream & output_)
+{
+	switch (typeCode_)
+	{
+		case 'b': { bool v;			if (!readRaw(input_, v)) return false; output_ << (v ? "true" : "false"); return true; }
+		case 'c': { std::int8_t v;	if (!readRaw(input_, v)) return false; output_ << static_cast<int>(v); return true; }
+		case 'C': { std::uint8_t v;	if (!readRaw(input_, v)) return false; output_ << static_cast<unsigned>(v); return true; }
+		case 's': { std::int16_t v;	if (!readRaw(input_, v)) return false; output_ << v; return true; }
+		case 'S': { std::uint16_t v;	if (!readRaw(input_, v)) return false; output_ << v; return true; }
+		case 'i': { std::int32_t v;	if (!readRaw(input_, v)) return false; output_ << v; return true; }
+		case 'I': { std::uint32_t v;	if (!readRaw(input_, v)) return false; output_ << v; return true; }
+		case 'q': { std::int64_t v;	if (!readRaw(input_, v)) return false; output_ << v; return true; }
+		case 'Q': { std::uint64_t v;	if (!readRaw(input_, v)) return false; output_ << v; return true; }
+		case 'f': { float v;		if (!readRaw(input_, v)) return false; output_ << v; return true; }
+		case 'd': { double v;		if (!readRaw(input_, v)) return false; output_ << v; return true; }
+		default:
+			return false;
+	}
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////
+bool decode(std::istream & input_, std::ostream & output_)
+{
+	char magic[ sizeof(BinaryLogInterface::Magic) ];
+	input_.read(magic, sizeof(magic));
+	if (!input_ || std::memcmp(magic, BinaryLogInterface::Magic, sizeof(magic)) != 0)
+		return false;
+
+	std::map<std::uint16_t, Descriptor> descriptors;
+
+	char recordTag;
+	while ( input_.get(recordTag) )
+	{
+		if (recordTag == BinaryLogInterface::DescriptorRecord)
+		{
+			std::uint16_t id, formatLength;
+			if (!readRaw(input_, id) || !readRaw(input_, formatLength))
+				return false;
+
+			Descriptor descriptor;
+			descriptor.format.resize(formatLength);
+			input_.read(descriptor.format.data(), formatLength);
+
+			std::uint8_t argCount;
+			if (!input_ || !readRaw(input_, argCount))
+				return false;
+
+			descriptor.argTypes.resize(argCount);
+			input_.read(descriptor.argTypes.data(), argCount);
+			if (!input_)
+				return false;
+
+			descriptors[id] = std::move(descriptor);
+		}
+		else if (recordTag == BinaryLogInterface::MessageRecord)
+		{
+			std::uint16_t id;
+			std::uint64_t timestamp;
+			if (!readRaw(input_, id) || !readRaw(input_, timestamp))
+				return false;
+
+			auto const it = descriptors.find(id);
+			if (it == descriptors.end())
+				return false;
+			auto const & descriptor = it->second;
+
+			output_ << '[' << timestamp << "] ";
+
+			// Each "{}" consumes the next argument; leftover arguments are appended.
+			std::size_t argIndex	= 0;
+			std::size_t textPos		= 0;
+			while (textPos < descriptor.format.size())
+			{
+				auto const placeholder = descriptor.format.find("{}", textPos);
+				if (placeholder == std::string::npos || argIndex >= descriptor.argTypes.size())
+				{
+					output_ << descriptor.format.substr(textPos);
+					textPos = descriptor.format.size();
+					break;
+				}
+
+				output_ << descriptor.format.substr(textPos, placeholder - textPos);
+				if ( !decodeArgument(input_, descriptor.argTypes[argIndex++], output_) )
+					return false;
+				textPos = placeholder + 2;
+			}
+			while (argIndex < descriptor.argTypes.size())
+			{
+				output_ << ' ';
+				if ( !decodeArgument(input_, descriptor.argTypes[argIndex++], output_) )
+					return false;
+			}
+
+			output_ << '\n';
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+} // namespace edge::binary_log
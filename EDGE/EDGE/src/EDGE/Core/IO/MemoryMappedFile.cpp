@@ -0,0 +1,225 @@
+#include "stdafx.h" // PCH.
+
+// Custom includes:
+#include <EDGE/Core/IO/MemoryMappedFile.hpp>	// The header of this unit.
+
+#ifdef _WIN32
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+namespace edge
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile && other_) noexcept
+	:
+	m_data{ other_.m_data },
+	m_size{ other_.m_size },
+	m_open{ other_.m_open },
+	m_fileHandle{ other_.m_fileHandle },
+	m_mappingHandle{ other_.m_mappingHandle },
+	m_fileDescriptor{ other_.m_fileDescriptor }
+{
+	other_.m_data			= nullptr;
+	other_.m_size			= 0;
+	other_.m_open			= false;
+	other_.m_fileHandle		= nullptr;
+	other_.m_mappingHandle	= nullptr;
+	other_.m_fileDescriptor	= -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile && other_) noexcept
+{
+	if (this != &other_)
+	{
+		this->close();
+
+		m_data				= other_.m_data;
+		m_size				= other_.m_size;
+		m_open				= other_.m_open;
+		m_fileHandle		= other_.m_fileHandle;
+		m_mappingHandle		= other_.m_mappingHandle;
+		m_fileDescriptor	= other_.m_fileDescriptor;
+
+		other_.m_data			= nullptr;
+		other_.m_size			= 0;
+		other_.m_open			= false;
+		other_.m_fileHandle		= nullptr;
+		other_.m_mappingHandle	= nullptr;
+		other_.m_fileDescriptor	= -1;
+	}
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+MemoryMappedFile::~MemoryMappedFile()
+{
+	this->close();
+}
+
+#ifdef _WIN32
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool MemoryMappedFile::open(std::filesystem::path const & path_)
+{
+	this->close();
+
+	HANDLE const file = ::CreateFileW(path_.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER fileSize;
+	if (!::GetFileSizeEx(file, &fileSize))
+	{
+		::CloseHandle(file);
+		return false;
+	}
+
+	// An empty file cannot be mapped but is a valid (empty) view.
+	if (fileSize.QuadPart == 0)
+	{
+		m_fileHandle	= file;
+		m_open			= true;
+		return true;
+	}
+
+	HANDLE const mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr)
+	{
+		::CloseHandle(file);
+		return false;
+	}
+
+	void* const view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr)
+	{
+		::CloseHandle(mapping);
+		::CloseHandle(file);
+		return false;
+	}
+
+	m_data			= view;
+	m_size			= static_cast<std::size_t>(fileSize.QuadPart);
+	m_fileHandle	= file;
+	m_mappingHandle	= mapping;
+	m_open			= true;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void MemoryMappedFile::close()
+{
+	if (m_data != nullptr)
+		::UnmapViewOfFile(m_data);
+	if (m_mappingHandle != nullptr)
+		::CloseHandle(m_mappingHandle);
+	if (m_fileHandle != nullptr)
+		::CloseHandle(m_fileHandle);
+
+	m_data			= nullptr;
+	m_size			= 0;
+	m_open			= false;
+	m_fileHandle	= nullptr;
+	m_mappingHandle	= nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void MemoryMappedFile::prefetch(std::size_t const offset_, std::size_t const length_) const
+{
+	if (m_data == nullptr || offset_ >= m_size)
+		return;
+
+#if _WIN32_WINNT >= 0x0602 // PrefetchVirtualMemory arrived with Windows 8.
+	std::size_t const length = std::min(length_ == 0 ? m_size - offset_ : length_, m_size - offset_);
+
+	WIN32_MEMORY_RANGE_ENTRY range;
+	range.VirtualAddress	= static_cast<char*>(m_data) + offset_;
+	range.NumberOfBytes		= length;
+	::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0);
+#else
+	static_cast<void>(length_);
+#endif
+}
+
+#else // POSIX
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool MemoryMappedFile::open(std::filesystem::path const & path_)
+{
+	this->close();
+
+	int const fd = ::open(path_.c_str(), O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	struct stat fileInfo;
+	if (::fstat(fd, &fileInfo) != 0)
+	{
+		::close(fd);
+		return false;
+	}
+
+	// An empty file cannot be mapped but is a valid (empty) view.
+	if (fileInfo.st_size == 0)
+	{
+		m_fileDescriptor	= fd;
+		m_open				= true;
+		return true;
+	}
+
+	void* const view = ::mmap(nullptr, static_cast<std::size_t>(fileInfo.st_size),
+		PROT_READ, MAP_PRIVATE, fd, 0);
+	if (view == MAP_FAILED)
+	{
+		::close(fd);
+		return false;
+	}
+
+	m_data				= view;
+	m_size				= static_cast<std::size_t>(fileInfo.st_size);
+	m_fileDescriptor	= fd;
+	m_open				= true;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void MemoryMappedFile::close()
+{
+	if (m_data != nullptr)
+		::munmap(m_data, m_size);
+	if (m_fileDescriptor >= 0)
+		::close(m_fileDescriptor);
+
+	m_data				= nullptr;
+	m_size				= 0;
+	m_open				= false;
+	m_fileDescriptor	= -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void MemoryMappedFile::prefetch(std::size_t const offset_, std::size_t const length_) const
+{
+	if (m_data == nullptr || offset_ >= m_size)
+		return;
+
+	std::size_t const length = std::min(length_ == 0 ? m_size - offset_ : length_, m_size - offset_);
+
+	// madvise wants page-aligned addresses - widen the range to page bounds.
+	std::size_t const pageSize	= static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+	std::size_t const begin		= offset_ & ~(pageSize - 1);
+	::madvise(static_cast<char*>(m_data) + begin, length + (offset_ - begin), MADV_WILLNEED);
+}
+
+#endif
+
+} // namespace edge
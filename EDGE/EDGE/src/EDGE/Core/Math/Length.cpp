@@ -0,0 +1,13 @@
+#include "stdafx.h" // PCH.
+
+// Custom includes:
+#include <EDGE/Core/Math/Length.hpp>	// The `BaseLength` header.
+
+namespace edge
+{
+	// Explicit instantiation definitions for the most commonly used types.
+	// Matching `extern template` declarations in the header keep every other TU
+	// from re-instantiating these classes.
+	template class BaseLength<float>;
+	template class BaseLength<double>;
+}
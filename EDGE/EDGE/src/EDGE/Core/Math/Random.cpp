@@ -7,6 +7,13 @@ namespace edge
 {
 	constexpr bool cxprNoRandomDevice = false;
 
+	namespace
+	{
+		// Distinguishes clock-based seeds of threads started within the same second
+		// (only used when `cxprNoRandomDevice` is set).
+		std::atomic<std::uint32_t> nextEngineIndex{ 0 };
+	}
+
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	std::mt19937& Random::getEngine()
 	{
@@ -25,14 +32,15 @@ namespace edge
 			// This method is used to prevent crashing when somebody set system time to pre-epoch (needs verification).
 
 			using int32seconds = std::chrono::duration<std::int32_t>;
-			static std::mt19937 mtEngine{
+			thread_local std::mt19937 mtEngine{
 				static_cast<std::uint32_t>( std::abs( std::chrono::duration_cast<int32seconds>(std::chrono::system_clock::now().time_since_epoch()).count() ) )
+					+ 0x9E3779B9 * nextEngineIndex.fetch_add(1, std::memory_order_relaxed)
 			};
 			return mtEngine;
 		}
 		else
 		{
-			static std::mt19937 mtEngine{ std::random_device{}() };
+			thread_local std::mt19937 mtEngine{ std::random_device{}() };
 			return mtEngine;
 		}
 	}
@@ -55,14 +63,15 @@ namespace edge
 			// This method is used to prevent crashing when somebody set system time to pre-epoch (needs verification).
 
 			using int32seconds = std::chrono::duration<std::int32_t>;
-			static std::mt19937_64 mtEngine{
+			thread_local std::mt19937_64 mtEngine{
 				static_cast<std::uint32_t>(std::abs(std::chrono::duration_cast<int32seconds>(std::chrono::system_clock::now().time_since_epoch()).count()))
+					+ 0x9E3779B9 * nextEngineIndex.fetch_add(1, std::memory_order_relaxed)
 			};
 			return mtEngine;
 		}
 		else
 		{
-			static std::mt19937_64 mtEngine{ std::random_device{}() };
+			thread_local std::mt19937_64 mtEngine{ std::random_device{}() };
 			return mtEngine;
 		}
 	}
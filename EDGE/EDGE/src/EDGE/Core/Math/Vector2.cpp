@@ -0,0 +1,14 @@
+#include "stdafx.h" // PCH.
+
+// Custom includes:
+#include <EDGE/Core/Math/Vector2.hpp>	// The `BaseVector2` header.
+
+namespace edge
+{
+	// Explicit instantiation definitions for the most commonly used types.
+	// Matching `extern template` declarations in the header keep every other TU
+	// from re-instantiating these classes.
+	template class BaseVector2<float>;
+	template class BaseVector2<double>;
+	template class BaseVector2<std::int32_t>;
+}
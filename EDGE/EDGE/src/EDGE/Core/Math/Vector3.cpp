@@ -0,0 +1,14 @@
+#include "stdafx.h" // PCH.
+
+// Custom includes:
+#include <EDGE/Core/Math/Vector3.hpp>	// The `BaseVector3` header.
+
+namespace edge
+{
+	// Explicit instantiation definitions for the most commonly used types.
+	// Matching `extern template` declarations in the header keep every other TU
+	// from re-instantiating these classes.
+	template class BaseVector3<float>;
+	template class BaseVector3<double>;
+	template class BaseVector3<std::int32_t>;
+}
@@ -0,0 +1,85 @@
+#include "stdafx.h" // PCH.
+
+// Custom includes:
+#include <EDGE/Core/Profiler.hpp>		// The header of this unit.
+
+namespace edge
+{
+
+/////////////////////////////////////////////////////////////////////////////////////
+Profiler& Profiler::instance()
+{
+	static Profiler profiler;
+	return profiler;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+void Profiler::record(char const * const name_, std::uint64_t const beginNs_, std::uint64_t const endNs_)
+{
+	auto & buffer = this->localBuffer();
+
+	auto const index = buffer.zoneCount.load(std::memory_order_relaxed) % ZonesPerThread;
+	buffer.zones[index] = Zone{ name_, beginNs_, endNs_ };
+	// The count is published after the zone so an exporting thread never reads
+	// a slot that was not written at least once.
+	buffer.zoneCount.fetch_add(1, std::memory_order_release);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+void Profiler::exportTrace(std::ostream & output_)
+{
+	std::lock_guard<std::mutex> lock{ m_threadsMutex };
+
+	output_ << "{\"traceEvents\":[";
+
+	bool first = true;
+	for (auto const & buffer : m_threads)
+	{
+		auto const total		= buffer->zoneCount.load(std::memory_order_acquire);
+		auto const available	= std::min<std::uint64_t>(total, ZonesPerThread);
+
+		for (std::uint64_t i = 0; i < available; i++)
+		{
+			auto const & zone = buffer->zones[(total - available + i) % ZonesPerThread];
+
+			if (!first)
+				output_ << ',';
+			first = false;
+
+			// Complete ("X") events; chrome://tracing expects microseconds.
+			output_ << "{\"name\":\"" << zone.name
+				<< "\",\"cat\":\"edge\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->threadId
+				<< ",\"ts\":" << zone.beginNs / 1000 << '.' << std::setw(3) << std::setfill('0') << zone.beginNs % 1000 << std::setfill(' ')
+				<< ",\"dur\":" << (zone.endNs - zone.beginNs) / 1000 << '.' << std::setw(3) << std::setfill('0') << (zone.endNs - zone.beginNs) % 1000 << std::setfill(' ')
+				<< '}';
+		}
+	}
+
+	output_ << "]}";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+void Profiler::clear()
+{
+	std::lock_guard<std::mutex> lock{ m_threadsMutex };
+	for (auto & buffer : m_threads)
+		buffer->zoneCount.store(0, std::memory_order_relaxed);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+Profiler::ThreadBuffer& Profiler::localBuffer()
+{
+	thread_local ThreadBuffer* buffer = nullptr;
+	if (!buffer)
+	{
+		auto owned = std::make_unique<ThreadBuffer>();
+		buffer = owned.get();
+
+		std::lock_guard<std::mutex> lock{ m_threadsMutex };
+		buffer->threadId = static_cast<std::uint32_t>( m_threads.size() + 1 );
+		m_threads.push_back( std::move(owned) );
+	}
+	return *buffer;
+}
+
+} // namespace edge
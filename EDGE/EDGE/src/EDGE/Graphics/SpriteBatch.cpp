@@ -0,0 +1,162 @@
+#include "stdafx.h" // PCH.
+
+// Custom includes:
+#include <EDGE/Graphics/SpriteBatch.hpp>	// The header of this unit.
+
+namespace edge
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+SpriteBatch::SpriteBatch(std::size_t const bucketCapacity_)
+	:
+	m_bucketCapacity{ bucketCapacity_ }
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SpriteBatch::begin()
+{
+	// Keep the buckets (and their GPU buffers) - only forget this frame's vertices.
+	for (auto & bucket : m_buckets)
+		bucket.vertices.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SpriteBatch::draw(sf::Sprite const & sprite_)
+{
+	sf::IntRect const rect		= sprite_.getTextureRect();
+	sf::Transform const & tf	= sprite_.getTransform();
+	sf::Color const color		= sprite_.getColor();
+
+	auto const width	= static_cast<float>(rect.width);
+	auto const height	= static_cast<float>(rect.height);
+	auto const left		= static_cast<float>(rect.left);
+	auto const top		= static_cast<float>(rect.top);
+
+	sf::Vector2f const corners[4] = {
+		tf.transformPoint(0.f, 0.f),
+		tf.transformPoint(width, 0.f),
+		tf.transformPoint(width, height),
+		tf.transformPoint(0.f, height)
+	};
+	sf::Vector2f const texCoords[4] = {
+		{ left, top },
+		{ left + width, top },
+		{ left + width, top + height },
+		{ left, top + height }
+	};
+
+	auto & vertices = this->bucketOf(sprite_.getTexture()).vertices;
+
+	// Two triangles: 0-1-2 and 0-2-3.
+	for (std::size_t const index : { 0u, 1u, 2u, 0u, 2u, 3u })
+		vertices.emplace_back(corners[index], color, texCoords[index]);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SpriteBatch::draw(sf::Texture const & texture_, sf::FloatRect const & destination_,
+	sf::IntRect const & textureRect_, sf::Color const & color_)
+{
+	sf::Vector2f const corners[4] = {
+		{ destination_.left, destination_.top },
+		{ destination_.left + destination_.width, destination_.top },
+		{ destination_.left + destination_.width, destination_.top + destination_.height },
+		{ destination_.left, destination_.top + destination_.height }
+	};
+
+	auto const left		= static_cast<float>(textureRect_.left);
+	auto const top		= static_cast<float>(textureRect_.top);
+	auto const width	= static_cast<float>(textureRect_.width);
+	auto const height	= static_cast<float>(textureRect_.height);
+
+	sf::Vector2f const texCoords[4] = {
+		{ left, top },
+		{ left + width, top },
+		{ left + width, top + height },
+		{ left, top + height }
+	};
+
+	auto & vertices = this->bucketOf(&texture_).vertices;
+
+	for (std::size_t const index : { 0u, 1u, 2u, 0u, 2u, 3u })
+		vertices.emplace_back(corners[index], color_, texCoords[index]);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SpriteBatch::draw(sf::Vertex const* vertices_, std::size_t const count_, sf::Texture const* texture_)
+{
+	// # Assertion note:
+	// The batch draws triangle lists - counts that are not a multiple of 3 indicate a logic error.
+	assert(count_ % 3 == 0);
+
+	auto & vertices = this->bucketOf(texture_).vertices;
+	vertices.insert(vertices.end(), vertices_, vertices_ + count_);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SpriteBatch::end(sf::RenderTarget & target_, sf::RenderStates states_)
+{
+	m_drawCallCount = 0;
+
+	bool const useBuffers = sf::VertexBuffer::isAvailable();
+
+	for (auto & bucket : m_buckets)
+	{
+		if (bucket.vertices.empty())
+			continue;
+
+		states_.texture = bucket.texture;
+
+		if (useBuffers)
+		{
+			// Grow in powers of two so a fluctuating sprite count settles on one allocation.
+			if (bucket.vertices.size() > bucket.bufferCapacity)
+			{
+				std::size_t newCapacity = std::max<std::size_t>(m_bucketCapacity, 1);
+				while (newCapacity < bucket.vertices.size())
+					newCapacity *= 2;
+
+				bucket.buffer.create(newCapacity);
+				bucket.bufferCapacity = newCapacity;
+			}
+
+			// A full-buffer update maps to glBufferData on stream buffers, letting the
+			// driver orphan last frame's storage instead of stalling on it.
+			bucket.buffer.update(bucket.vertices.data(), bucket.vertices.size(), 0);
+			target_.draw(bucket.buffer, 0, bucket.vertices.size(), states_);
+		}
+		else
+		{
+			// No VBO support (very old GPUs) - fall back to client-side arrays.
+			target_.draw(bucket.vertices.data(), bucket.vertices.size(), sf::Triangles, states_);
+		}
+
+		++m_drawCallCount;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::vertexCount() const
+{
+	std::size_t count = 0;
+	for (auto const & bucket : m_buckets)
+		count += bucket.vertices.size();
+	return count;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+SpriteBatch::Bucket& SpriteBatch::bucketOf(sf::Texture const* texture_)
+{
+	auto const it = m_bucketIndices.find(texture_);
+	if (it != m_bucketIndices.end())
+		return m_buckets[it->second];
+
+	m_bucketIndices.emplace(texture_, m_buckets.size());
+
+	auto & bucket	= m_buckets.emplace_back();
+	bucket.texture	= texture_;
+	bucket.vertices.reserve(m_bucketCapacity);
+	return bucket;
+}
+
+} // namespace edge